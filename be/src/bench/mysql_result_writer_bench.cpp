@@ -0,0 +1,105 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "runtime/mysql_result_writer.h"
+
+namespace starrocks {
+
+static const size_t kNumRows = 4096;
+
+// range(0): number of bigint columns
+// range(1): number of double columns
+// range(2): number of nullable varchar columns
+static void make_columns(const benchmark::State& state, Columns* columns, std::vector<LogicalType>* types) {
+    std::mt19937_64 rng(0);
+    for (int i = 0; i < state.range(0); i++) {
+        auto column = Int64Column::create();
+        for (size_t r = 0; r < kNumRows; r++) {
+            column->append(static_cast<int64_t>(rng() % 100000000));
+        }
+        columns->emplace_back(std::move(column));
+        types->emplace_back(TYPE_BIGINT);
+    }
+    for (int i = 0; i < state.range(1); i++) {
+        auto column = DoubleColumn::create();
+        for (size_t r = 0; r < kNumRows; r++) {
+            column->append(static_cast<double>(rng() % 1000000) / 100);
+        }
+        columns->emplace_back(std::move(column));
+        types->emplace_back(TYPE_DOUBLE);
+    }
+    for (int i = 0; i < state.range(2); i++) {
+        auto column = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+        for (size_t r = 0; r < kNumRows; r++) {
+            if (rng() % 10 == 0) {
+                column->append_nulls(1);
+            } else {
+                std::string s(8 + rng() % 24, 'a' + rng() % 26);
+                column->append_datum(Datum(Slice(s)));
+            }
+        }
+        columns->emplace_back(std::move(column));
+        types->emplace_back(TYPE_VARCHAR);
+    }
+}
+
+// Serialize rows by calling put_mysql_row_buffer for each cell, which is the way before.
+static void BM_MysqlRowsByRow(benchmark::State& state) {
+    Columns columns;
+    std::vector<LogicalType> types;
+    make_columns(state, &columns, &types);
+    std::vector<std::string> rows(kNumRows);
+    MysqlRowBuffer buffer;
+    for (auto _ : state) {
+        for (size_t r = 0; r < kNumRows; r++) {
+            for (auto& column : columns) {
+                column->put_mysql_row_buffer(&buffer, r);
+            }
+            size_t len = buffer.length();
+            buffer.move_content(&rows[r]);
+            buffer.reserve(len * 1.1);
+        }
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static void BM_MysqlRowsByColumn(benchmark::State& state) {
+    Columns columns;
+    std::vector<LogicalType> types;
+    make_columns(state, &columns, &types);
+    std::vector<std::string> rows(kNumRows);
+    MysqlTextRowsBuilder builder;
+    for (auto _ : state) {
+        builder.build(columns, types, kNumRows);
+        for (size_t r = 0; r < kNumRows; r++) {
+            builder.copy_row(r, &rows[r]);
+        }
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+BENCHMARK(BM_MysqlRowsByRow)->Args({4, 0, 0})->Args({0, 4, 0})->Args({0, 0, 4})->Args({4, 2, 4});
+BENCHMARK(BM_MysqlRowsByColumn)->Args({4, 0, 0})->Args({0, 4, 0})->Args({0, 0, 4})->Args({4, 2, 4});
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -139,7 +139,7 @@ template <bool nullable>
 static inline void insertString(orc::StringVectorBatch* vb, size_t pos, size_t kBatchNum, ObjectPool& pool) {
     std::string* data;
     if (kBatchNum % 2 == 0) {
-        data = pool.add(new std::string(strings::Substitute("Hello, ORC! %ld", pos)));
+        data = pool.add(new std::string(strings::Substitute("Hello, ORC! $0", pos)));
     } else {
         data = pool.add(new std::string("Hello, ORC!"));
     }
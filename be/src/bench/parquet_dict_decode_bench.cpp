@@ -98,6 +98,70 @@ static void BM_DictDecoder(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecoder)->DenseRange(0, 100, 10)->Unit(benchmark::kMillisecond);
 
+// Decode dict codes of a lazy column whose rows are partially selected by predicates.
+// range(0): percentage of selected rows
+// range(1): 0 decodes all the rows then filters, 1 only decodes the selected rows then filters
+static void BM_DictDecodeSelected(benchmark::State& state) {
+    static const int kLongDictLength = 32;
+    std::string dict_data;
+    for (int i = 0; i < kDictSize * kLongDictLength; i++) {
+        dict_data.push_back(kAlphaNumber[i % kAlphaNumber.size()]);
+    }
+    PlainEncoder<Slice> encoder;
+    std::vector<Slice> dict_values;
+    for (int i = 0; i < kDictSize; i++) {
+        dict_values.emplace_back(Slice(dict_data.data() + i * kLongDictLength, kLongDictLength));
+    }
+    encoder.append((const uint8_t*)dict_values.data(), kDictSize);
+    Slice data = encoder.build();
+    PlainDecoder<Slice> decoder;
+    decoder.set_data(data);
+    DictDecoder<Slice> dict_decoder;
+    dict_decoder.set_dict(kTestChunkSize, kDictSize, &decoder);
+
+    auto selectivity = state.range(0);
+    bool lazy_decode = state.range(1) == 1;
+
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist(0, 99);
+    std::vector<int32_t> dict_codes(kTestChunkSize);
+    Filter filter(kTestChunkSize);
+    for (int i = 0; i < kTestChunkSize; i++) {
+        dict_codes[i] = dist(rng) % kDictSize;
+        filter[i] = dist(rng) < selectivity;
+    }
+
+    auto nulls_ptr =
+            ColumnHelper::as_column<NullableColumn>(ColumnHelper::create_column(TypeDescriptor{TYPE_INT}, true));
+    NullableColumn* nulls = nulls_ptr.get();
+    nulls->resize(kTestChunkSize);
+    uint8_t* null_data = nulls->mutable_null_column()->mutable_raw_data();
+
+    ColumnPtr column = ColumnHelper::create_column(TypeDescriptor{TYPE_VARCHAR}, true);
+    for (auto _ : state) {
+        state.PauseTiming();
+        column->reset_column();
+        memset(null_data, 0, kTestChunkSize);
+        nulls->set_has_null(false);
+        state.ResumeTiming();
+
+        if (lazy_decode) {
+            // same as the lazy dict decode of parquet column reader, unselected rows are decoded as empty values
+            for (int i = 0; i < kTestChunkSize; i++) {
+                null_data[i] |= !filter[i];
+            }
+            nulls->set_has_null(true);
+        }
+        Status st = dict_decoder.get_dict_values(dict_codes, *nulls, column.get());
+        column->filter(filter);
+        benchmark::DoNotOptimize(st);
+    }
+}
+
+BENCHMARK(BM_DictDecodeSelected)
+        ->ArgsProduct({{1, 10, 30, 50, 80, 100}, {0, 1}})
+        ->Unit(benchmark::kMicrosecond);
+
 } // namespace parquet
 } // namespace starrocks
 
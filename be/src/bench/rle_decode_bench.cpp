@@ -0,0 +1,124 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "util/faststring.h"
+#include "util/rle_encoding.h"
+
+namespace starrocks {
+
+static const int kNumValues = 64 * 1024;
+
+// range(0): bit width
+// range(1): average length of repeated runs, 0 means random values which are mostly literal runs
+template <typename T>
+static void encode_values(const benchmark::State& state, faststring* buffer, std::vector<T>* values) {
+    int bit_width = state.range(0);
+    int run_length = state.range(1);
+    std::mt19937 rng(0);
+    RleEncoder<T> encoder(buffer, bit_width);
+    T value = 0;
+    for (int i = 0; i < kNumValues; i++) {
+        if (run_length == 0 || rng() % run_length == 0) {
+            value = static_cast<T>(rng() % (1UL << bit_width));
+        }
+        values->push_back(value);
+        encoder.Put(value);
+    }
+    encoder.Flush();
+}
+
+// Decoding of def/rep levels, which used RleDecoder before.
+static void BM_RleDecoderLevels(benchmark::State& state) {
+    faststring buffer;
+    std::vector<int16_t> values;
+    encode_values(state, &buffer, &values);
+    std::vector<int16_t> levels(kNumValues);
+    for (auto _ : state) {
+        RleDecoder<int16_t> decoder(buffer.data(), buffer.size(), state.range(0));
+        benchmark::DoNotOptimize(decoder.GetBatch(levels.data(), kNumValues));
+    }
+    state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+static void BM_RleBatchDecoderLevels(benchmark::State& state) {
+    faststring buffer;
+    std::vector<int16_t> values;
+    encode_values(state, &buffer, &values);
+    std::vector<int16_t> levels(kNumValues);
+    for (auto _ : state) {
+        RleBatchDecoder<int16_t> decoder(buffer.data(), buffer.size(), state.range(0));
+        benchmark::DoNotOptimize(decoder.GetBatch(levels.data(), kNumValues));
+    }
+    state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+// Dict indexes of parquet data pages.
+static void BM_RleBatchDecoderDictIndexes(benchmark::State& state) {
+    faststring buffer;
+    std::vector<uint32_t> values;
+    encode_values(state, &buffer, &values);
+    std::vector<uint32_t> indexes(kNumValues);
+    for (auto _ : state) {
+        RleBatchDecoder<uint32_t> decoder(buffer.data(), buffer.size(), state.range(0));
+        benchmark::DoNotOptimize(decoder.GetBatch(indexes.data(), kNumValues));
+    }
+    state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+static void BM_RleBatchDecoderWithDict(benchmark::State& state) {
+    faststring buffer;
+    std::vector<uint32_t> values;
+    encode_values(state, &buffer, &values);
+    std::vector<int64_t> dict(1UL << state.range(0));
+    for (size_t i = 0; i < dict.size(); i++) {
+        dict[i] = i * 7;
+    }
+    std::vector<int64_t> result(kNumValues);
+    for (auto _ : state) {
+        RleBatchDecoder<uint32_t> decoder(buffer.data(), buffer.size(), state.range(0));
+        benchmark::DoNotOptimize(decoder.GetBatchWithDict(dict.data(), dict.size(), result.data(), kNumValues));
+    }
+    state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+// Skip half of the values, like skipping rows filtered out by predicates.
+static void BM_RleBatchDecoderSkip(benchmark::State& state) {
+    faststring buffer;
+    std::vector<uint32_t> values;
+    encode_values(state, &buffer, &values);
+    std::vector<uint32_t> indexes(1024);
+    for (auto _ : state) {
+        RleBatchDecoder<uint32_t> decoder(buffer.data(), buffer.size(), state.range(0));
+        for (int i = 0; i < kNumValues; i += 2048) {
+            benchmark::DoNotOptimize(decoder.Skip(1024));
+            benchmark::DoNotOptimize(decoder.GetBatch(indexes.data(), 1024));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+BENCHMARK(BM_RleDecoderLevels)->ArgsProduct({{1, 2, 3}, {0, 4, 64}});
+BENCHMARK(BM_RleBatchDecoderLevels)->ArgsProduct({{1, 2, 3}, {0, 4, 64}});
+BENCHMARK(BM_RleBatchDecoderDictIndexes)->ArgsProduct({{4, 8, 12, 17, 24}, {0, 4}});
+BENCHMARK(BM_RleBatchDecoderWithDict)->ArgsProduct({{4, 8, 12, 17}, {0, 4}});
+BENCHMARK(BM_RleBatchDecoderSkip)->ArgsProduct({{4, 8, 12, 17}, {0, 4}});
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -164,6 +164,59 @@ static void Benchmark_RuntimeFilter_Eval(benchmark::State& state) {
 
 BENCHMARK(Benchmark_RuntimeFilter_Eval)->Apply(RuntimeFilterArg1);
 
+// range(0): estimated rows to size the bloom filter, range(1): number of inserted keys.
+// A filter with far fewer keys than estimated is sparse, which is the case compression pays off.
+// The cases compress every filter regardless of runtime_filter_compress_min_bytes, which is off by default,
+// to show the cost and the saved bytes before enabling it.
+static void build_serialized_runtime_filter(const benchmark::State& state, PTransmitRuntimeFilterParams* params) {
+    RuntimeBloomFilter<TYPE_INT> bf;
+    bf.init(state.range(0));
+    std::mt19937 rng(0);
+    for (int64_t i = 0; i < state.range(1); i++) {
+        int32_t key = rng();
+        bf.insert(key);
+    }
+    std::string* data = params->mutable_data();
+    data->resize(RuntimeFilterHelper::max_runtime_filter_serialized_size(&bf));
+    data->resize(RuntimeFilterHelper::serialize_runtime_filter(RF_VERSION_V2, &bf,
+                                                               reinterpret_cast<uint8_t*>(data->data())));
+}
+
+static void Benchmark_RuntimeFilter_Compress(benchmark::State& state) {
+    PTransmitRuntimeFilterParams params;
+    build_serialized_runtime_filter(state, &params);
+    size_t raw_size = params.data().size();
+    size_t sent_size = 0;
+    for (auto _ : state) {
+        PTransmitRuntimeFilterParams request = params;
+        RuntimeFilterHelper::compress_runtime_filter(&request, 1);
+        sent_size = request.data().size();
+    }
+    state.counters["raw_bytes"] = raw_size;
+    state.counters["sent_bytes"] = sent_size;
+    state.SetBytesProcessed(state.iterations() * raw_size);
+}
+
+static void Benchmark_RuntimeFilter_Decompress(benchmark::State& state) {
+    PTransmitRuntimeFilterParams params;
+    build_serialized_runtime_filter(state, &params);
+    size_t raw_size = params.data().size();
+    RuntimeFilterHelper::compress_runtime_filter(&params, 1);
+    for (auto _ : state) {
+        ObjectPool pool;
+        std::string buffer;
+        auto data = RuntimeFilterHelper::get_runtime_filter_data(params, &buffer);
+        JoinRuntimeFilter* rf = nullptr;
+        RuntimeFilterHelper::deserialize_runtime_filter(&pool, &rf, reinterpret_cast<const uint8_t*>(data->data),
+                                                        data->size);
+        benchmark::DoNotOptimize(rf);
+    }
+    state.SetBytesProcessed(state.iterations() * raw_size);
+}
+
+BENCHMARK(Benchmark_RuntimeFilter_Compress)->ArgsProduct({{1 << 20, 1 << 24}, {1000, 100000, 1 << 24}});
+BENCHMARK(Benchmark_RuntimeFilter_Decompress)->ArgsProduct({{1 << 20, 1 << 24}, {1000, 100000, 1 << 24}});
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
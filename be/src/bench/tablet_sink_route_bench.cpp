@@ -0,0 +1,138 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "exec/tablet_sink_sender.h"
+
+namespace starrocks {
+
+// Compare the routing of rows to backends in tablet sink:
+// mode 0: scan all the rows for each backend, lookup the backends of the tablet for each row and backend
+// mode 1: TabletSinkSender::route_rows_to_nodes, lookup the backends of the tablet once for each row
+class TabletSinkRouteBench {
+public:
+    TabletSinkRouteBench(int mode, int chunk_size, int num_tablets, int num_nodes, int num_replicas)
+            : _mode(mode),
+              _chunk_size(chunk_size),
+              _num_tablets(num_tablets),
+              _num_nodes(num_nodes),
+              _num_replicas(num_replicas) {}
+
+    void do_bench(benchmark::State& state);
+
+private:
+    void _init();
+    void _route_per_node();
+    void _route_once();
+
+    int _mode;
+    int _chunk_size;
+    int _num_tablets;
+    int _num_nodes;
+    int _num_replicas;
+
+    std::vector<int64_t> _tablet_ids;
+    std::vector<uint16_t> _selection_idx;
+    std::unordered_map<int64_t, std::vector<int64_t>> _tablet_to_be;
+    std::unordered_map<int64_t, size_t> _node_positions;
+    std::vector<std::vector<uint32_t>> _node_selections;
+};
+
+void TabletSinkRouteBench::_init() {
+    std::mt19937 rand(0);
+    for (int i = 0; i < _num_tablets; i++) {
+        std::vector<int64_t> be_ids;
+        for (int j = 0; j < _num_replicas; j++) {
+            be_ids.push_back((i + j) % _num_nodes);
+        }
+        _tablet_to_be[10000 + i] = std::move(be_ids);
+    }
+    for (int i = 0; i < _num_nodes; i++) {
+        _node_positions[i] = i;
+    }
+    _node_selections.resize(_num_nodes);
+    _tablet_ids.resize(_chunk_size);
+    _selection_idx.resize(_chunk_size);
+    for (int i = 0; i < _chunk_size; i++) {
+        _tablet_ids[i] = 10000 + rand() % _num_tablets;
+    }
+    std::iota(_selection_idx.begin(), _selection_idx.end(), 0);
+}
+
+void TabletSinkRouteBench::_route_per_node() {
+    for (auto& [be_id, pos] : _node_positions) {
+        auto& selection = _node_selections[pos];
+        selection.clear();
+        selection.reserve(_selection_idx.size());
+        for (uint16_t row : _selection_idx) {
+            const auto& be_ids = _tablet_to_be.find(_tablet_ids[row])->second;
+            if (std::find(be_ids.begin(), be_ids.end(), be_id) != be_ids.end()) {
+                selection.emplace_back(row);
+            }
+        }
+    }
+}
+
+void TabletSinkRouteBench::_route_once() {
+    stream_load::TabletSinkSender::route_rows_to_nodes(_tablet_ids, _selection_idx, _tablet_to_be, _node_positions,
+                                                       false, &_node_selections);
+}
+
+void TabletSinkRouteBench::do_bench(benchmark::State& state) {
+    _init();
+    for (auto _ : state) {
+        if (_mode == 0) {
+            _route_per_node();
+        } else {
+            _route_once();
+        }
+        benchmark::DoNotOptimize(_node_selections.data());
+    }
+    state.SetItemsProcessed(state.iterations() * _chunk_size);
+}
+
+static void bench_func(benchmark::State& state) {
+    int mode = state.range(0);
+    int chunk_size = state.range(1);
+    int num_tablets = state.range(2);
+    int num_nodes = state.range(3);
+    int num_replicas = state.range(4);
+
+    TabletSinkRouteBench perf(mode, chunk_size, num_tablets, num_nodes, num_replicas);
+    perf.do_bench(state);
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    // mode, chunk_size, num_tablets, num_nodes, num_replicas
+    for (int mode : {0, 1}) {
+        b->Args({mode, 4096, 16, 3, 1});
+        b->Args({mode, 4096, 16, 3, 3});
+        b->Args({mode, 4096, 1024, 10, 3});
+        b->Args({mode, 4096, 1024, 50, 3});
+        b->Args({mode, 4096, 10240, 100, 3});
+    }
+}
+
+BENCHMARK(bench_func)->Apply(process_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -28,6 +28,9 @@
 #include "common/logging.h"
 #include "common/statusor.h"
 #include "gutil/strings/substitute.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
+#include "util/xxh3.h"
 
 namespace starrocks {
 
@@ -39,6 +42,8 @@ namespace fs = std::filesystem;
 // block_size may cause heavy read amplification. So, we also limit it to 2 MB as an empirical value.
 const size_t BlockCache::MAX_BLOCK_SIZE = 2 * 1024 * 1024;
 
+static const std::string kHotSetManifestName = "datacache_hot_set";
+
 BlockCache* BlockCache::instance() {
     static BlockCache cache;
     return &cache;
@@ -63,6 +68,25 @@ Status BlockCache::init(const CacheOptions& options) {
         return Status::NotSupported("unsupported block cache engine");
     }
     RETURN_IF_ERROR(_kv_cache->init(options));
+    if (options.enable_admission) {
+        size_t capacity = options.mem_space_size;
+        for (auto& dir : options.disk_spaces) {
+            capacity += dir.size;
+        }
+        _admission_sketch = std::make_unique<FrequencySketch>(capacity / std::max<size_t>(_block_size, 1));
+        _admission_min_frequency = options.admission_min_frequency;
+        LOG(INFO) << "enable datacache admission, min_frequency: " << _admission_min_frequency
+                  << ", sketch width: " << _admission_sketch->width();
+    }
+    if (options.hot_set_persist_interval_seconds > 0 && !options.meta_path.empty()) {
+        _hot_set = std::make_unique<HotSetTracker>(options.hot_set_capacity, options.hot_set_sample_interval);
+        _hot_set_path = (fs::path(options.meta_path) / kHotSetManifestName).string();
+        _hot_set_persist_interval_seconds = options.hot_set_persist_interval_seconds;
+        _warmup_threads = std::max<size_t>(options.warmup_threads, 1);
+        _warmup_max_bytes_per_second = options.warmup_max_bytes_per_second;
+        _stopped = false;
+        _hot_set_thread = std::thread([this] { _hot_set_worker(); });
+    }
     _initialized.store(true, std::memory_order_relaxed);
     return Status::OK();
 }
@@ -79,7 +103,31 @@ Status BlockCache::write_buffer(const CacheKey& cache_key, off_t offset, const I
 
     size_t index = offset / _block_size;
     std::string block_key = fmt::format("{}/{}", cache_key, index);
-    return _kv_cache->write_buffer(block_key, buffer, options);
+    if (!_admit(block_key, options)) {
+        // not an error, the block is written once it is missed frequently enough
+        if (options) {
+            options->stats.skipped = true;
+        }
+        return Status::OK();
+    }
+    Status st = _kv_cache->write_buffer(block_key, buffer, options);
+    if (_hot_set && st.ok() && _hot_set->sample()) {
+        _hot_set->record(block_key, buffer.size());
+    }
+    return st;
+}
+
+bool BlockCache::_admit(const std::string& block_key, const WriteCacheOptions* options) {
+    if (!_admission_sketch) {
+        return true;
+    }
+    uint32_t freq = _admission_sketch->increment(XXH3_64bits(block_key.data(), block_key.size()));
+    if (freq >= _admission_min_frequency || (options && options->priority > 0)) {
+        _admit_count.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    _reject_count.fetch_add(1, std::memory_order_relaxed);
+    return false;
 }
 
 static void empty_deleter(void*) {}
@@ -111,7 +159,12 @@ Status BlockCache::read_buffer(const CacheKey& cache_key, off_t offset, size_t s
 
     size_t index = offset / _block_size;
     std::string block_key = fmt::format("{}/{}", cache_key, index);
-    return _kv_cache->read_buffer(block_key, offset - index * _block_size, size, buffer, options);
+    size_t block_offset = offset - index * _block_size;
+    Status st = _kv_cache->read_buffer(block_key, block_offset, size, buffer, options);
+    if (_hot_set && st.ok() && _hot_set->sample()) {
+        _hot_set->record(block_key, block_offset + size);
+    }
+    return st;
 }
 
 StatusOr<size_t> BlockCache::read_buffer(const CacheKey& cache_key, off_t offset, size_t size, char* data,
@@ -154,9 +207,139 @@ const DataCacheMetrics BlockCache::cache_metrics(int level) const {
     return _kv_cache->cache_metrics(level);
 }
 
+BlockCache::AdmissionMetrics BlockCache::admission_metrics() const {
+    AdmissionMetrics metrics;
+    metrics.enabled = _admission_sketch != nullptr;
+    metrics.admit_count = _admit_count.load(std::memory_order_relaxed);
+    metrics.reject_count = _reject_count.load(std::memory_order_relaxed);
+    return metrics;
+}
+
+BlockCache::WarmUpMetrics BlockCache::warmup_metrics() const {
+    WarmUpMetrics metrics;
+    metrics.enabled = _hot_set != nullptr;
+    metrics.running = _warmup_running.load(std::memory_order_relaxed);
+    metrics.total_blocks = _warmup_total_blocks.load(std::memory_order_relaxed);
+    metrics.finished_blocks = _warmup_finished_blocks.load(std::memory_order_relaxed);
+    metrics.warmed_blocks = _warmup_blocks.load(std::memory_order_relaxed);
+    metrics.warmed_bytes = _warmup_bytes.load(std::memory_order_relaxed);
+    return metrics;
+}
+
+Status BlockCache::save_hot_set() {
+    if (!_hot_set) {
+        return Status::OK();
+    }
+    return HotSetTracker::save(_hot_set_path, _hot_set->hot_entries());
+}
+
+void BlockCache::_hot_set_worker() {
+    _warm_up();
+    std::unique_lock l(_hot_set_mutex);
+    while (!_hot_set_cv.wait_for(l, std::chrono::seconds(_hot_set_persist_interval_seconds),
+                                 [this] { return _stopped; })) {
+        l.unlock();
+        Status st = save_hot_set();
+        LOG_IF(WARNING, !st.ok()) << "save datacache hot set failed: " << st;
+        l.lock();
+    }
+}
+
+void BlockCache::_warm_up() {
+    auto entries_or = HotSetTracker::load(_hot_set_path);
+    if (!entries_or.ok()) {
+        if (!entries_or.status().is_not_found()) {
+            LOG(WARNING) << "load datacache hot set failed: " << entries_or.status();
+        }
+        return;
+    }
+    auto& entries = entries_or.value();
+    _warmup_total_blocks.store(entries.size(), std::memory_order_relaxed);
+    _warmup_running.store(true, std::memory_order_relaxed);
+    _warmup_start = std::chrono::steady_clock::now();
+    DeferOp defer([this] { _warmup_running.store(false, std::memory_order_relaxed); });
+    LOG(INFO) << "start to warm up datacache with " << entries.size() << " hot blocks";
+
+    std::unique_ptr<ThreadPool> pool;
+    Status st = ThreadPoolBuilder("datacache_warmup")
+                        .set_min_threads(1)
+                        .set_max_threads(_warmup_threads)
+                        .set_max_queue_size(entries.size())
+                        .build(&pool);
+    if (!st.ok()) {
+        LOG(WARNING) << "create datacache warm up thread pool failed: " << st;
+        return;
+    }
+    // The hottest blocks are warmed first.
+    for (auto& entry : entries) {
+        st = pool->submit_func([this, &entry] { _warm_up_block(entry); });
+        if (!st.ok()) {
+            LOG(WARNING) << "submit datacache warm up task failed: " << st;
+            break;
+        }
+    }
+    pool->wait();
+    pool->shutdown();
+    LOG(INFO) << "finish warming up datacache, warmed blocks: " << _warmup_blocks.load()
+              << ", warmed bytes: " << _warmup_bytes.load();
+}
+
+void BlockCache::_warm_up_block(const HotSetTracker::Entry& entry) {
+    DeferOp defer([this] { _warmup_finished_blocks.fetch_add(1, std::memory_order_relaxed); });
+    {
+        std::lock_guard l(_hot_set_mutex);
+        if (_stopped) {
+            return;
+        }
+    }
+    // The blocks admitted before restart are admitted again without waiting for new misses.
+    if (_admission_sketch) {
+        uint64_t hash = XXH3_64bits(entry.key.data(), entry.key.size());
+        for (uint32_t i = 0; i < std::min(entry.frequency, _admission_min_frequency); i++) {
+            _admission_sketch->increment(hash);
+        }
+    }
+    // Reading the block back loads the disk-resident data into the memory tier.
+    IOBuffer buffer;
+    if (!_kv_cache->read_buffer(entry.key, 0, entry.size, &buffer, nullptr).ok()) {
+        return;
+    }
+    _hot_set->record(entry.key, entry.size);
+    _warmup_blocks.fetch_add(1, std::memory_order_relaxed);
+    int64_t warmed_bytes = _warmup_bytes.fetch_add(entry.size, std::memory_order_relaxed) + entry.size;
+
+    // Throttle the warm up to avoid saturating the disks.
+    if (_warmup_max_bytes_per_second > 0) {
+        auto expected = std::chrono::milliseconds(warmed_bytes * 1000 / _warmup_max_bytes_per_second);
+        auto elapsed = std::chrono::steady_clock::now() - _warmup_start;
+        if (expected > elapsed) {
+            std::this_thread::sleep_for(expected - elapsed);
+        }
+    }
+}
+
+void BlockCache::_stop_hot_set_worker() {
+    if (!_hot_set_thread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard l(_hot_set_mutex);
+        _stopped = true;
+    }
+    _hot_set_cv.notify_all();
+    _hot_set_thread.join();
+}
+
 Status BlockCache::shutdown() {
+    _stop_hot_set_worker();
+    if (_hot_set) {
+        Status st = save_hot_set();
+        LOG_IF(WARNING, !st.ok()) << "save datacache hot set failed: " << st;
+    }
     Status st = _kv_cache->shutdown();
     _kv_cache = nullptr;
+    _admission_sketch = nullptr;
+    _hot_set = nullptr;
     _initialized.store(false, std::memory_order_relaxed);
     return st;
 }
@@ -14,6 +14,11 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <thread>
+
+#include "block_cache/frequency_sketch.h"
+#include "block_cache/hot_set.h"
 #include "block_cache/kv_cache.h"
 #include "common/status.h"
 
@@ -63,6 +68,28 @@ public:
 
     const DataCacheMetrics cache_metrics(int level = 0) const;
 
+    struct AdmissionMetrics {
+        bool enabled = false;
+        int64_t admit_count = 0;
+        int64_t reject_count = 0;
+    };
+
+    AdmissionMetrics admission_metrics() const;
+
+    struct WarmUpMetrics {
+        bool enabled = false;
+        bool running = false;
+        int64_t total_blocks = 0;
+        int64_t finished_blocks = 0;
+        int64_t warmed_blocks = 0;
+        int64_t warmed_bytes = 0;
+    };
+
+    WarmUpMetrics warmup_metrics() const;
+
+    // Persist the hot blocks to the manifest under the meta path.
+    Status save_hot_set();
+
     // Shutdown the cache instance to save some state meta
     Status shutdown();
 
@@ -79,7 +106,39 @@ private:
     BlockCache() = default;
 #endif
 
+    // Whether the block should be written to cache. A block is admitted once it has been written (missed)
+    // `admission_min_frequency` times recently, so blocks touched by a single large scan don't evict the
+    // working set.
+    bool _admit(const std::string& block_key, const WriteCacheOptions* options);
+
+    // Warm up the cache with the hot set manifest saved before restart, and then persist the hot set periodically.
+    void _hot_set_worker();
+    void _warm_up();
+    void _warm_up_block(const HotSetTracker::Entry& entry);
+    void _stop_hot_set_worker();
+
     size_t _block_size = 0;
+    std::unique_ptr<FrequencySketch> _admission_sketch;
+    uint32_t _admission_min_frequency = 0;
+    std::atomic<int64_t> _admit_count = 0;
+    std::atomic<int64_t> _reject_count = 0;
+
+    std::unique_ptr<HotSetTracker> _hot_set;
+    std::string _hot_set_path;
+    int64_t _hot_set_persist_interval_seconds = 0;
+    size_t _warmup_threads = 1;
+    int64_t _warmup_max_bytes_per_second = 0;
+    std::thread _hot_set_thread;
+    std::mutex _hot_set_mutex;
+    std::condition_variable _hot_set_cv;
+    bool _stopped = false;
+
+    std::atomic<bool> _warmup_running = false;
+    std::chrono::steady_clock::time_point _warmup_start;
+    std::atomic<int64_t> _warmup_total_blocks = 0;
+    std::atomic<int64_t> _warmup_finished_blocks = 0;
+    std::atomic<int64_t> _warmup_blocks = 0;
+    std::atomic<int64_t> _warmup_bytes = 0;
     std::unique_ptr<KvCache> _kv_cache;
     std::atomic<bool> _initialized = false;
 };
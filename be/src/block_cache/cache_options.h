@@ -40,6 +40,15 @@ struct CacheOptions {
     size_t max_flying_memory_mb;
     bool enable_cache_adaptor;
     size_t skip_read_factor;
+    // admission
+    bool enable_admission = false;
+    uint32_t admission_min_frequency = 2;
+    // hot set, 0 means the hot set is not persisted
+    int64_t hot_set_persist_interval_seconds = 0;
+    size_t hot_set_capacity = 0;
+    uint32_t hot_set_sample_interval = 1;
+    size_t warmup_threads = 1;
+    int64_t warmup_max_bytes_per_second = 0;
 };
 
 struct WriteCacheOptions {
@@ -47,10 +56,14 @@ struct WriteCacheOptions {
     uint64_t ttl_seconds = 0;
     // If overwrite=true, the cache value will be replaced if it already exists.
     bool overwrite = true;
+    // The priority hint of the data, the data with positive priority skips the admission policy.
+    int32_t priority = 0;
 
     struct Stats {
         int64_t write_mem_bytes = 0;
         int64_t write_disk_bytes = 0;
+        // The block is rejected by the admission policy and nothing is written.
+        bool skipped = false;
     } stats;
 };
 
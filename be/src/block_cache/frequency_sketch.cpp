@@ -0,0 +1,92 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/frequency_sketch.h"
+
+#include <algorithm>
+
+namespace starrocks {
+
+// NUM_ROWS rows of 4-bit counters, limit the table to 32MB.
+static constexpr size_t kMinWidth = 1024;
+static constexpr size_t kMaxWidth = 1UL << 24;
+
+FrequencySketch::FrequencySketch(size_t capacity) {
+    _width = kMinWidth;
+    while (_width < capacity && _width < kMaxWidth) {
+        _width <<= 1;
+    }
+    _sample_size = std::max<size_t>(capacity, kMinWidth) * 10;
+    size_t num_words = _width * NUM_ROWS / 16;
+    _table = std::make_unique<std::atomic<uint64_t>[]>(num_words);
+    for (size_t i = 0; i < num_words; i++) {
+        _table[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t FrequencySketch::_counter_index(uint64_t hash, int row) const {
+    // double hashing to derive the position of each row
+    auto h1 = static_cast<uint32_t>(hash);
+    auto h2 = static_cast<uint32_t>(hash >> 32) | 1;
+    return row * _width + ((h1 + row * h2) & (_width - 1));
+}
+
+uint32_t FrequencySketch::_counter(size_t index) const {
+    uint64_t word = _table[index / 16].load(std::memory_order_relaxed);
+    return (word >> ((index % 16) * 4)) & 0xF;
+}
+
+void FrequencySketch::_increment_counter(size_t index) {
+    auto& word = _table[index / 16];
+    int shift = (index % 16) * 4;
+    uint64_t value = word.load(std::memory_order_relaxed);
+    while (((value >> shift) & 0xF) < MAX_FREQUENCY) {
+        if (word.compare_exchange_weak(value, value + (1UL << shift), std::memory_order_relaxed)) {
+            break;
+        }
+    }
+}
+
+uint32_t FrequencySketch::increment(uint64_t hash) {
+    uint32_t freq = MAX_FREQUENCY;
+    for (int row = 0; row < NUM_ROWS; row++) {
+        size_t index = _counter_index(hash, row);
+        _increment_counter(index);
+        freq = std::min(freq, _counter(index));
+    }
+    // Only the thread reaching the sample size ages the table.
+    if (_additions.fetch_add(1, std::memory_order_relaxed) + 1 == _sample_size) {
+        _age();
+        _additions.store(0, std::memory_order_relaxed);
+    }
+    return freq;
+}
+
+uint32_t FrequencySketch::frequency(uint64_t hash) const {
+    uint32_t freq = MAX_FREQUENCY;
+    for (int row = 0; row < NUM_ROWS; row++) {
+        freq = std::min(freq, _counter(_counter_index(hash, row)));
+    }
+    return freq;
+}
+
+void FrequencySketch::_age() {
+    size_t num_words = _width * NUM_ROWS / 16;
+    for (size_t i = 0; i < num_words; i++) {
+        uint64_t value = _table[i].load(std::memory_order_relaxed);
+        _table[i].store((value >> 1) & 0x7777777777777777UL, std::memory_order_relaxed);
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,56 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace starrocks {
+
+// A count-min sketch with 4-bit counters, which estimates how many times a key has been seen recently.
+// All the counters are halved once the number of additions reaches 10 times of the capacity, so the
+// estimation reflects the recent accesses only, as described in the TinyLFU paper.
+// It is thread safe, concurrent updates of the same counter may be lost, which is acceptable for an estimation.
+class FrequencySketch {
+public:
+    static constexpr uint32_t MAX_FREQUENCY = 15;
+
+    // |capacity| is the expected number of distinct keys kept by the cache.
+    explicit FrequencySketch(size_t capacity);
+
+    // Increase the frequency of |hash| and return the estimated frequency after the increment.
+    uint32_t increment(uint64_t hash);
+
+    uint32_t frequency(uint64_t hash) const;
+
+    size_t width() const { return _width; }
+
+private:
+    static constexpr int NUM_ROWS = 4;
+
+    size_t _counter_index(uint64_t hash, int row) const;
+    uint32_t _counter(size_t index) const;
+    void _increment_counter(size_t index);
+    void _age();
+
+    size_t _width = 0;
+    size_t _sample_size = 0;
+    // 16 counters per word, the counters of row i are [i * _width, (i + 1) * _width)
+    std::unique_ptr<std::atomic<uint64_t>[]> _table;
+    std::atomic<size_t> _additions = 0;
+};
+
+} // namespace starrocks
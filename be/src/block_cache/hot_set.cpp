@@ -0,0 +1,166 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/hot_set.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "fs/fs_util.h"
+#include "gutil/strings/substitute.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
+
+namespace starrocks {
+
+// Manifest layout:
+// magic(4) | version(4) | num_entries(4) | [key_len(4) | key | size(4) | frequency(4)] * num_entries | crc32c(4)
+static constexpr uint32_t kManifestMagic = 0x53485344; // "DSHS"
+static constexpr uint32_t kManifestVersion = 1;
+static constexpr uint32_t kMaxFrequency = std::numeric_limits<uint32_t>::max();
+
+HotSetTracker::HotSetTracker(size_t capacity, uint32_t sample_interval)
+        : _shard_capacity(std::max<size_t>(capacity / kNumShards, 1)),
+          _decay_interval(_shard_capacity * 10),
+          _sample_interval(sample_interval) {}
+
+void HotSetTracker::record(const std::string& key, size_t size) {
+    auto& shard = _shards[std::hash<std::string>()(key) % kNumShards];
+    std::lock_guard l(shard.mutex);
+    if (++shard.additions >= _decay_interval) {
+        _decay(&shard);
+        shard.additions = 0;
+    }
+    auto iter = shard.blocks.find(key);
+    if (iter != shard.blocks.end()) {
+        iter->second.first = std::max<uint32_t>(iter->second.first, size);
+        if (iter->second.second < kMaxFrequency) {
+            iter->second.second++;
+        }
+        return;
+    }
+    // A full shard admits new blocks only after decaying drops the cold ones, so that a scan of cold blocks
+    // can't flush the hot set.
+    if (shard.blocks.size() < _shard_capacity) {
+        shard.blocks.emplace(key, std::make_pair(static_cast<uint32_t>(size), 1U));
+    }
+}
+
+void HotSetTracker::_decay(Shard* shard) {
+    for (auto iter = shard->blocks.begin(); iter != shard->blocks.end();) {
+        iter->second.second >>= 1;
+        if (iter->second.second == 0) {
+            iter = shard->blocks.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+std::vector<HotSetTracker::Entry> HotSetTracker::hot_entries() const {
+    std::vector<Entry> entries;
+    for (auto& shard : _shards) {
+        std::lock_guard l(shard.mutex);
+        for (auto& [key, value] : shard.blocks) {
+            entries.push_back({key, value.first, value.second});
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& lhs, const Entry& rhs) { return lhs.frequency > rhs.frequency; });
+    return entries;
+}
+
+size_t HotSetTracker::size() const {
+    size_t size = 0;
+    for (auto& shard : _shards) {
+        std::lock_guard l(shard.mutex);
+        size += shard.blocks.size();
+    }
+    return size;
+}
+
+Status HotSetTracker::save(const std::string& path, const std::vector<Entry>& entries) {
+    std::string buf;
+    put_fixed32_le(&buf, kManifestMagic);
+    put_fixed32_le(&buf, kManifestVersion);
+    put_fixed32_le(&buf, entries.size());
+    for (auto& entry : entries) {
+        put_fixed32_le(&buf, entry.key.size());
+        buf.append(entry.key);
+        put_fixed32_le(&buf, entry.size);
+        put_fixed32_le(&buf, entry.frequency);
+    }
+    put_fixed32_le(&buf, crc32c::Value(buf.data(), buf.size()));
+
+    std::string tmp_path = path + ".tmp";
+    ASSIGN_OR_RETURN(auto file, fs::new_writable_file(tmp_path));
+    RETURN_IF_ERROR(file->append(buf));
+    RETURN_IF_ERROR(file->sync());
+    RETURN_IF_ERROR(file->close());
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(path));
+    return fs->rename_file(tmp_path, path);
+}
+
+StatusOr<std::vector<HotSetTracker::Entry>> HotSetTracker::load(const std::string& path) {
+    ASSIGN_OR_RETURN(auto file, fs::new_random_access_file(path));
+    ASSIGN_OR_RETURN(auto buf, file->read_all());
+    auto corrupted = [&path]() {
+        return Status::Corruption(strings::Substitute("corrupted hot set manifest $0", path));
+    };
+
+    if (buf.size() < 16) {
+        return corrupted();
+    }
+    size_t body_size = buf.size() - 4;
+    if (crc32c::Value(buf.data(), body_size) != decode_fixed32_le((const uint8_t*)buf.data() + body_size)) {
+        return corrupted();
+    }
+    const auto* p = (const uint8_t*)buf.data();
+    const uint8_t* end = p + body_size;
+    if (decode_fixed32_le(p) != kManifestMagic) {
+        return corrupted();
+    }
+    if (decode_fixed32_le(p + 4) != kManifestVersion) {
+        return Status::NotSupported(
+                strings::Substitute("unknown hot set manifest version $0", decode_fixed32_le(p + 4)));
+    }
+    uint32_t num_entries = decode_fixed32_le(p + 8);
+    p += 12;
+
+    std::vector<Entry> entries;
+    entries.reserve(num_entries);
+    for (uint32_t i = 0; i < num_entries; i++) {
+        if (end - p < 4) {
+            return corrupted();
+        }
+        uint32_t key_len = decode_fixed32_le(p);
+        p += 4;
+        if (static_cast<size_t>(end - p) < static_cast<size_t>(key_len) + 8) {
+            return corrupted();
+        }
+        Entry entry;
+        entry.key.assign((const char*)p, key_len);
+        p += key_len;
+        entry.size = decode_fixed32_le(p);
+        entry.frequency = decode_fixed32_le(p + 4);
+        p += 8;
+        entries.emplace_back(std::move(entry));
+    }
+    if (p != end) {
+        return corrupted();
+    }
+    return entries;
+}
+
+} // namespace starrocks
@@ -0,0 +1,83 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/statusor.h"
+
+namespace starrocks {
+
+// Tracks the frequently accessed blocks of datacache. The hot blocks are persisted as a manifest
+// periodically, which is used to warm up the cache after BE restarts.
+class HotSetTracker {
+public:
+    struct Entry {
+        std::string key;
+        // the accessed length of the block from its beginning
+        uint32_t size = 0;
+        uint32_t frequency = 0;
+    };
+
+    // |capacity| is the maximum number of blocks tracked. One in every |sample_interval| accesses is recorded.
+    explicit HotSetTracker(size_t capacity, uint32_t sample_interval = 1);
+
+    // Whether the current access should be recorded.
+    bool sample() const {
+        return _sample_interval <= 1 ||
+               (_accesses.fetch_add(1, std::memory_order_relaxed) + 1) % _sample_interval == 0;
+    }
+
+    // Record an access of block |key|, |size| is the accessed length of the block from its beginning.
+    void record(const std::string& key, size_t size);
+
+    // Return the tracked blocks ordered by frequency descending.
+    std::vector<Entry> hot_entries() const;
+
+    size_t size() const;
+
+    // Save |entries| to |path| atomically.
+    static Status save(const std::string& path, const std::vector<Entry>& entries);
+
+    static StatusOr<std::vector<Entry>> load(const std::string& path);
+
+private:
+    static constexpr size_t kNumShards = 16;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        // key => (size, frequency)
+        std::unordered_map<std::string, std::pair<uint32_t, uint32_t>> blocks;
+        // records since the last decay
+        size_t additions = 0;
+    };
+
+    // Halve the frequencies of the shard and drop the blocks with zero frequency.
+    static void _decay(Shard* shard);
+
+    size_t _shard_capacity;
+    // the shard is decayed every |_decay_interval| records, like FrequencySketch
+    size_t _decay_interval;
+    uint32_t _sample_interval;
+    mutable std::atomic<uint32_t> _accesses = 0;
+    Shard _shards[kNumShards];
+};
+
+} // namespace starrocks
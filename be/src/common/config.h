@@ -194,6 +194,22 @@ CONF_Bool(compress_rowbatches, "true");
 // Compress ratio when shuffle row_batches in network, not in storage engine.
 // If ratio is less than this value, use uncompressed data instead.
 CONF_mDouble(rpc_compress_ratio_threshold, "1.1");
+// If true, every exchange channel picks the codec among none, LZ4 and ZSTD which minimizes
+// the estimated transmit time, based on the sampled compress cost and the measured network bandwidth.
+CONF_mBool(exchange_adaptive_compression_enable, "false");
+// Number of chunks sent by a channel between two rounds of sampling the compression codecs.
+CONF_mInt32(exchange_adaptive_compression_sample_interval, "64");
+// Exchange chunks whose serialized size is not less than this are compressed into a buffer owned by
+// the rpc attachment directly, instead of being copied into the attachment after compression.
+CONF_mInt64(exchange_zero_copy_compression_min_bytes, "65536");
+// If true, the exchange receiver appends the following received chunks to a small chunk
+// before returning it, so the downstream operators process fewer and fuller chunks.
+CONF_mBool(enable_exchange_receiver_coalesce_chunks, "false");
+// A received chunk is coalesced if its rows are less than chunk_size * this ratio.
+CONF_mDouble(exchange_receiver_coalesce_chunk_ratio, "0.5");
+// If true, the requests of exchange pass through, whose chunks are handed over in memory, are delivered
+// to the receiver in the same process directly instead of through brpc to localhost.
+CONF_mBool(enable_exchange_pass_through_bypass_brpc, "false");
 // Serialize and deserialize each returned row batch.
 CONF_Bool(serialize_batch, "false");
 // Interval between profile reports; in seconds.
@@ -304,6 +320,15 @@ CONF_mInt64(max_compaction_candidate_num, "40960");
 
 // If true, SR will try no to merge delta column back to main segment
 CONF_mBool(enable_lazy_delta_column_compaction, "true");
+// If true, when a compaction's only live input rowset has delta column groups and no deleted rows,
+// only the updated columns are rewritten, and the pages of the other columns are copied as is.
+CONF_mBool(enable_pk_column_subset_compaction, "false");
+// Fall back to full compaction if the updated columns exceed this ratio of all the columns,
+// because the replaced column pages are kept in the output segment as garbage.
+CONF_mDouble(pk_column_subset_compaction_max_column_ratio, "0.3");
+// Fall back to full compaction if the garbage left in a segment by previous column subset compactions
+// exceeds this ratio of the segment file size, full compaction drops all the garbage.
+CONF_mDouble(pk_column_subset_compaction_max_garbage_ratio, "0.3");
 
 CONF_mInt32(update_compaction_check_interval_seconds, "10");
 CONF_mInt32(update_compaction_num_threads_per_disk, "1");
@@ -343,6 +368,12 @@ CONF_mInt32(compaction_trace_threshold, "60");
 // If enabled, will verify compaction/schema-change output rowset correctness
 CONF_mBool(enable_rowset_verify, "false");
 
+// If enabled, compaction of several non-overlapping rowsets whose key ranges are disjoint hard links their
+// segments into the output rowset instead of decoding and merging the rows.
+CONF_mBool(enable_shortcut_compaction_for_disjoint_rowsets, "false");
+// Segments smaller than this are merged rather than linked, so that small segments still get combined.
+CONF_mInt64(shortcut_compaction_min_segment_bytes, "134217728");
+
 // Max columns of each compaction group.
 // If the number of schema columns is greater than this,
 // the columns will be divided into groups for vertical compaction.
@@ -380,6 +411,10 @@ CONF_mInt32(number_tablet_writer_threads, "16");
 CONF_mInt64(max_queueing_memtable_per_tablet, "2");
 // when memory limit exceed and memtable last update time exceed this time, memtable will be flushed
 CONF_mInt64(stale_memtable_flush_time_sec, "30");
+// For aggregate/unique/primary key tables, memtable keeps the data sorted and aggregated as runs each time
+// the write buffer is full, and merges the runs once their number exceeds this value, so that flush only
+// needs to merge a few sorted runs instead of sorting all the data again.
+CONF_mInt32(memtable_max_sorted_runs, "4");
 
 // delta writer hang after this time, be will exit since storage is in error state
 CONF_Int32(be_exit_after_disk_write_hang_second, "60");
@@ -606,6 +641,12 @@ CONF_mDouble(storage_high_usage_disk_protect_ratio, "0.1"); // 10%
 
 // Number of thread for flushing memtable per store.
 CONF_mInt32(flush_thread_num_per_store, "2");
+// Number of threads shared by all memtable flushes to encode the columns of a segment in parallel.
+// 0 means the number of cpu cores.
+CONF_Int32(column_encode_thread_num, "0");
+// The columns of a loaded segment are encoded in parallel only if the number of columns is not less than this.
+// <= 0 means never encode in parallel.
+CONF_mInt32(parallel_column_encode_min_columns, "32");
 
 // Config for tablet meta checkpoint.
 CONF_mInt32(tablet_meta_checkpoint_min_new_rowsets_num, "10");
@@ -731,6 +772,9 @@ CONF_Int64(pipeline_sink_io_thread_pool_queue_size, "102400");
 CONF_Int64(pipeline_sink_buffer_size, "64");
 // The degree of parallelism of brpc.
 CONF_Int64(pipeline_sink_brpc_dop, "64");
+// If true, exchange receivers grant byte credits by their free buffer in the responses, and
+// SinkBuffer limits the in-flight bytes to each destination by the credits.
+CONF_mBool(enable_exchange_credit_flow_control, "false");
 // Used to reject coming fragment instances, when the number of running drivers
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
@@ -833,9 +877,27 @@ CONF_Int32(orc_loading_buffer_size, "8388608");
 CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
 CONF_Bool(parquet_page_index_enable, "true");
+// Read dict encoded string columns as dict codes and only decode the rows selected by predicates.
+CONF_mBool(parquet_lazy_dict_decode_enable, "true");
+// Skip row groups whose bloom filters reject all the values of an equal/in predicate.
+CONF_mBool(parquet_bloom_filter_enable, "true");
+// Prepare the next row group and read its data in background while the current row group is decoded.
+CONF_mBool(parquet_prefetch_next_row_group_enable, "true");
+// The number of threads reading the prefetched data of scans, vCPUs by default.
+CONF_Int64(scan_prefetch_thread_pool_thread_num, "0");
+CONF_Int64(scan_prefetch_thread_pool_queue_size, "102400");
+
+// parquet writer
+// Write split block bloom filters for integer and string columns.
+CONF_mBool(parquet_writer_bloom_filter_enable, "false");
+// False positive probability of the written bloom filters.
+CONF_mDouble(parquet_writer_bloom_filter_fpp, "0.05");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
+// Gaps larger than 128KB are only coalesced while the skipped bytes are at most this ratio of the requested bytes,
+// e.g. pages skipped by the parquet page index. Non-positive value disables the limit.
+CONF_mDouble(io_coalesce_read_max_skip_ratio, "1.0");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
 CONF_Int32(io_tasks_per_scan_operator, "4");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
@@ -889,6 +951,11 @@ CONF_Int64(deliver_broadcast_rf_passthrough_bytes_limit, "131072");
 // in passthrough style, the number of inflight RPCs of parallel deliveries are issued is not exceeds this limit.
 CONF_Int64(deliver_broadcast_rf_passthrough_inflight_num, "10");
 CONF_Int64(send_rpc_runtime_filter_timeout_ms, "1000");
+// serialized runtime filters not smaller than this size are compressed with LZ4 before being sent, which
+// mostly shrinks sparse bloom filters. non-positive value disables compression.
+// BEs which don't know the compression deserialize the compressed data as is, so only enable it after all
+// the BEs of the cluster are upgraded, e.g. 1048576.
+CONF_mInt64(runtime_filter_compress_min_bytes, "0");
 // if runtime filter size is larger than send_runtime_filter_via_http_rpc_min_size, be will transmit runtime filter via http protocol.
 // this is a default value, maybe changed by global_runtime_filter_rpc_http_min_size in session variable.
 CONF_Int64(send_runtime_filter_via_http_rpc_min_size, "67108864");
@@ -1056,6 +1123,20 @@ CONF_Bool(datacache_adaptor_enable, "true");
 // the more requests will be sent to the network.
 // Usually there is no need to modify it.
 CONF_Int64(datacache_skip_read_factor, "1");
+// Whether to admit a block into datacache only after it is missed `datacache_admission_min_frequency` times
+// recently, which prevents large one-off scans from evicting the working set.
+CONF_Bool(datacache_admission_enable, "false");
+CONF_Int32(datacache_admission_min_frequency, "2");
+// The interval (seconds) to persist the hot blocks of datacache under `datacache_meta_path`, which are used to
+// warm up the cache after restart. 0 means disable.
+CONF_Int64(datacache_hot_set_persist_interval_seconds, "0");
+// Maximum number of hot blocks to persist.
+CONF_Int64(datacache_hot_set_capacity, "100000");
+// Record one in every N accesses of datacache blocks into the hot set, 1 records all of them.
+CONF_Int32(datacache_hot_set_sample_interval, "8");
+CONF_Int32(datacache_warmup_threads, "4");
+// The read throughput limit of the warm up after restart, 0 means unlimited.
+CONF_Int64(datacache_warmup_max_bytes_per_second, "104857600");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
 // DataCache engines, alternatives: cachelib, starcache.
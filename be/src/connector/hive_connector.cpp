@@ -99,6 +99,9 @@ Status HiveDataSource::open(RuntimeState* state) {
         _scan_range.datacache_options.priority == -1) {
         _use_datacache = false;
     }
+    if (_scan_range.__isset.datacache_options && _scan_range.datacache_options.__isset.priority) {
+        _datacache_priority = _scan_range.datacache_options.priority;
+    }
     if (state->query_options().__isset.enable_file_metacache) {
         _use_file_metacache = state->query_options().enable_file_metacache;
     }
@@ -391,6 +394,8 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
         _profile.shared_buffered_direct_io_count =
                 ADD_CHILD_COUNTER(_runtime_profile, "DirectIOCount", TUnit::UNIT, prefix);
         _profile.shared_buffered_direct_io_timer = ADD_CHILD_TIMER(_runtime_profile, "DirectIOTime", prefix);
+        _profile.shared_buffered_prefetch_io_count =
+                ADD_CHILD_COUNTER(_runtime_profile, "PrefetchIOCount", TUnit::UNIT, prefix);
     }
 
     if (_use_datacache) {
@@ -795,6 +800,7 @@ Status HiveDataSource::_init_scanner(RuntimeState* state) {
     }
     scanner_params.use_datacache = _use_datacache;
     scanner_params.enable_populate_datacache = _enable_populate_datacache;
+    scanner_params.datacache_priority = _datacache_priority;
     scanner_params.can_use_any_column = _can_use_any_column;
     scanner_params.can_use_min_max_count_opt = _can_use_min_max_count_opt;
     scanner_params.use_file_metacache = _use_file_metacache;
@@ -65,6 +65,45 @@ void replaceAll(std::string& str, const std::string& from, const std::string& to
 
 namespace starrocks {
 
+AvroSchemaValues::~AvroSchemaValues() {
+    for (auto& [_, schema_value] : _values) {
+        avro_value_decref(&schema_value.value);
+        avro_value_iface_decref(schema_value.iface);
+    }
+    if (_reader != nullptr) {
+        avro_reader_free(_reader);
+    }
+}
+
+StatusOr<avro_value_t*> AvroSchemaValues::read(int schema_id, avro_schema_t schema, const void* payload,
+                                               size_t size) {
+    auto [iter, inserted] = _values.try_emplace(schema_id);
+    SchemaValue& schema_value = iter->second;
+    if (inserted) {
+        avro_value_iface_t* iface = avro_generic_class_from_schema(schema);
+        if (iface == nullptr || avro_generic_value_new(iface, &schema_value.value) != 0) {
+            auto err_msg = "Cannot allocate new value instance: " + std::string(avro_strerror());
+            if (iface != nullptr) {
+                avro_value_iface_decref(iface);
+            }
+            _values.erase(iter);
+            return Status::InternalError(err_msg);
+        }
+        schema_value.iface = iface;
+    }
+
+    if (_reader == nullptr) {
+        _reader = avro_reader_memory(static_cast<const char*>(payload), size);
+    } else {
+        avro_reader_memory_set_source(_reader, static_cast<const char*>(payload), size);
+    }
+    avro_value_reset(&schema_value.value);
+    if (avro_value_read(_reader, &schema_value.value) != 0) {
+        return Status::InternalError("serdes deserialize avro failed: " + std::string(avro_strerror()));
+    }
+    return &schema_value.value;
+}
+
 AvroScanner::AvroScanner(RuntimeState* state, RuntimeProfile* profile, const TBrokerScanRange& scan_range,
                          ScannerCounter* counter)
         : FileScanner(state, profile, scan_range.params, counter),
@@ -276,17 +315,16 @@ Status AvroScanner::_parse_avro(Chunk* chunk, const std::shared_ptr<SequentialFi
         }
         data = reinterpret_cast<uint8_t*>(_parser_buf->ptr);
         length = _parser_buf->remaining();
-        serdes_schema_t* schema;
-        serdes_err_t err =
-                serdes_deserialize_avro(_serdes, &avro_value, &schema, data, length, _err_buf, sizeof(_err_buf));
-        if (err) {
-            auto err_msg = "serdes deserialize avro failed: " + std::string(_err_buf);
+        auto value_or = _deserialize_avro(data, length);
+        if (!value_or.ok()) {
+            auto err_msg = std::string(value_or.status().message());
             LOG(ERROR) << err_msg;
             _counter->num_rows_filtered++;
             _state->append_error_msg_to_file("", err_msg);
             return Status::InternalError("serdes deserialize avro failed");
         }
-        DeferOp op([&] { avro_value_decref(&avro_value); });
+        // The value is owned by _schema_values and reused by the next message of the same schema.
+        avro_value = *value_or.value();
 #endif
         size_t chunk_row_num = chunk->num_rows();
         Status st = Status::OK();
@@ -330,6 +368,20 @@ Status AvroScanner::_parse_avro(Chunk* chunk, const std::shared_ptr<SequentialFi
     return Status::OK();
 }
 
+// serdes_deserialize_avro() builds the generic value class from the writer schema and allocates a new
+// value for every message. Instead, only the framing is read by serdes, and the message is read into the
+// value of its schema, which is reused by the following messages of the same schema.
+StatusOr<avro_value_t*> AvroScanner::_deserialize_avro(const uint8_t* data, size_t length) {
+    const void* payload = data;
+    size_t payload_size = length;
+    serdes_schema_t* schema = nullptr;
+    serdes_err_t err = serdes_framing_read(_serdes, &payload, &payload_size, &schema, _err_buf, sizeof(_err_buf));
+    if (err) {
+        return Status::InternalError("serdes deserialize avro failed: " + std::string(_err_buf));
+    }
+    return _schema_values.read(serdes_schema_id(schema), serdes_schema_avro(schema), payload, payload_size);
+}
+
 Status AvroScanner::_construct_row_without_jsonpath(const avro_value_t& avro_value, Chunk* chunk) {
     _found_columns.assign(chunk->num_columns(), false);
     size_t element_count = _data_idx_to_fieldname.size();
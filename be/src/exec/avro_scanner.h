@@ -15,6 +15,7 @@
 #pragma once
 
 #include <string_view>
+#include <unordered_map>
 
 #include "column/nullable_column.h"
 #include "common/compiler_util.h"
@@ -39,6 +40,33 @@ namespace starrocks {
 
 using AvroPath = SimpleJsonPath;
 
+// Generic values of the writer schemas of avro messages. The value class and the value of a schema are
+// created once, and every message is read into the value of its schema after reset.
+class AvroSchemaValues {
+public:
+    AvroSchemaValues() = default;
+    ~AvroSchemaValues();
+
+    AvroSchemaValues(const AvroSchemaValues&) = delete;
+    AvroSchemaValues& operator=(const AvroSchemaValues&) = delete;
+
+    // Read the binary encoded |payload| written by |schema|. The returned value is owned by this object,
+    // and is valid until the next read of the same |schema_id|.
+    StatusOr<avro_value_t*> read(int schema_id, avro_schema_t schema, const void* payload, size_t size);
+
+    size_t num_schemas() const { return _values.size(); }
+
+private:
+    struct SchemaValue {
+        avro_value_iface_t* iface = nullptr;
+        avro_value_t value;
+    };
+
+    // schema id => value of the schema
+    std::unordered_map<int, SchemaValue> _values;
+    avro_reader_t _reader = nullptr;
+};
+
 class AvroScanner final : public FileScanner {
 public:
     AvroScanner(RuntimeState* state, RuntimeProfile* profile, const TBrokerScanRange& scan_range,
@@ -83,6 +111,7 @@ private:
     Status _get_array_element(const avro_value_t* cur_value, size_t idx, avro_value_t* element);
     std::string _preprocess_jsonpaths(std::string jsonpath);
     Status _construct_row_without_jsonpath(const avro_value_t& avro_value, Chunk* chunk);
+    StatusOr<avro_value_t*> _deserialize_avro(const uint8_t* data, size_t length);
 
     const TBrokerScanRange& _scan_range;
     serdes_t* _serdes;
@@ -101,6 +130,7 @@ private:
     std::vector<SlotInfo> _data_idx_to_slot;
     std::vector<std::string> _data_idx_to_fieldname;
     bool _init_data_idx_to_slot_once;
+    AvroSchemaValues _schema_values;
 
 #if BE_TEST
     avro_file_reader_t _dbreader;
@@ -86,6 +86,11 @@ Status HashJoinBuilder::append_chunk(const ChunkPtr& chunk) {
     return Status::OK();
 }
 
+Status HashJoinBuilder::prepare_key_columns() {
+    TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_ht.prepare_key_columns()));
+    return Status::OK();
+}
+
 Status HashJoinBuilder::build(RuntimeState* state) {
     SCOPED_TIMER(_hash_joiner.build_metrics().build_ht_timer);
     TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_ht.build(state)));
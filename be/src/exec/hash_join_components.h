@@ -61,6 +61,8 @@ public:
 
     Status append_chunk(const ChunkPtr& chunk);
 
+    Status prepare_key_columns();
+
     Status build(RuntimeState* state);
 
     size_t hash_table_row_count() { return _ht.get_row_count(); }
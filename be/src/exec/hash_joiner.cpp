@@ -203,6 +203,13 @@ Status HashJoiner::append_spill_task(RuntimeState* state, std::function<StatusOr
     return Status::OK();
 }
 
+Status HashJoiner::prepare_build_key_columns() {
+    if (_phase == HashJoinPhase::BUILD) {
+        RETURN_IF_ERROR(_hash_join_builder->prepare_key_columns());
+    }
+    return Status::OK();
+}
+
 Status HashJoiner::build_ht(RuntimeState* state) {
     if (_phase == HashJoinPhase::BUILD) {
         RETURN_IF_ERROR(_hash_join_builder->build(state));
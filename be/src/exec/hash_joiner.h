@@ -208,6 +208,8 @@ public:
 
     [[nodiscard]] Status append_spill_task(RuntimeState* state, std::function<StatusOr<ChunkPtr>()>& spill_task);
 
+    // The runtime filters can be created after the key columns are prepared, without waiting for build_ht.
+    [[nodiscard]] Status prepare_build_key_columns();
     [[nodiscard]] Status build_ht(RuntimeState* state);
     // probe phase
     [[nodiscard]] Status push_chunk(RuntimeState* state, ChunkPtr&& chunk);
@@ -191,6 +191,10 @@ void HdfsScanner::close() noexcept {
     }
     bool expect = false;
     if (!_closed.compare_exchange_strong(expect, true)) return;
+    if (_shared_buffered_input_stream) {
+        // wait for the prefetch reads, which update the io stats of the underlying stream
+        _shared_buffered_input_stream->release();
+    }
     update_counter();
     do_close(_runtime_state);
     _file.reset(nullptr);
@@ -212,8 +216,20 @@ Status HdfsScanner::open_random_access_file() {
     _shared_buffered_input_stream = std::make_shared<io::SharedBufferedInputStream>(input_stream, filename, file_size);
     const io::SharedBufferedInputStream::CoalesceOptions options = {
             .max_dist_size = config::io_coalesce_read_max_distance_size,
-            .max_buffer_size = config::io_coalesce_read_max_buffer_size};
+            .max_buffer_size = config::io_coalesce_read_max_buffer_size,
+            .max_skip_ratio = config::io_coalesce_read_max_skip_ratio};
     _shared_buffered_input_stream->set_coalesce_options(options);
+    // The prefetch stream reads the remote file directly, it would fetch the blocks in datacache again.
+    if (!_scanner_params.use_datacache) {
+        _shared_buffered_input_stream->set_prefetch_stream_opener(
+                [this, file_size]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+                    ASSIGN_OR_RETURN(auto file, _scanner_params.fs->new_random_access_file(_scanner_params.path));
+                    file->set_size(file_size);
+                    std::shared_ptr<io::SeekableInputStream> stream =
+                            std::make_shared<CountedSeekableInputStream>(file->stream(), &_prefetch_fs_stats);
+                    return stream;
+                });
+    }
     input_stream = _shared_buffered_input_stream;
 
     // input_stream = CacheInputStream(input_stream)
@@ -221,6 +237,7 @@ Status HdfsScanner::open_random_access_file() {
         _cache_input_stream = std::make_shared<io::CacheInputStream>(_shared_buffered_input_stream, filename, file_size,
                                                                      _scanner_params.modification_time);
         _cache_input_stream->set_enable_populate_cache(_scanner_params.enable_populate_datacache);
+        _cache_input_stream->set_priority(_scanner_params.datacache_priority);
         _cache_input_stream->set_enable_block_buffer(config::datacache_block_buffer_enable);
         _shared_buffered_input_stream->set_align_size(_cache_input_stream->get_align_size());
         input_stream = _cache_input_stream;
@@ -345,15 +362,16 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->shared_buffered_direct_io_count, _shared_buffered_input_stream->direct_io_count());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_bytes, _shared_buffered_input_stream->direct_io_bytes());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_timer, _shared_buffered_input_stream->direct_io_timer());
+        COUNTER_UPDATE(profile->shared_buffered_prefetch_io_count, _shared_buffered_input_stream->prefetch_io_count());
     }
 
     {
         COUNTER_UPDATE(profile->app_io_timer, _app_stats.io_ns);
         COUNTER_UPDATE(profile->app_io_counter, _app_stats.io_count);
         COUNTER_UPDATE(profile->app_io_bytes_read_counter, _app_stats.bytes_read);
-        COUNTER_UPDATE(profile->fs_bytes_read_counter, _fs_stats.bytes_read);
-        COUNTER_UPDATE(profile->fs_io_timer, _fs_stats.io_ns);
-        COUNTER_UPDATE(profile->fs_io_counter, _fs_stats.io_count);
+        COUNTER_UPDATE(profile->fs_bytes_read_counter, _fs_stats.bytes_read + _prefetch_fs_stats.bytes_read);
+        COUNTER_UPDATE(profile->fs_io_timer, _fs_stats.io_ns + _prefetch_fs_stats.io_ns);
+        COUNTER_UPDATE(profile->fs_io_counter, _fs_stats.io_count + _prefetch_fs_stats.io_count);
     }
 
     // update scanner private profile.
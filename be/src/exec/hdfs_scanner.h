@@ -130,6 +130,7 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* shared_buffered_direct_io_count = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_bytes = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_timer = nullptr;
+    RuntimeProfile::Counter* shared_buffered_prefetch_io_count = nullptr;
 
     RuntimeProfile::Counter* app_io_bytes_read_counter = nullptr;
     RuntimeProfile::Counter* app_io_timer = nullptr;
@@ -205,6 +206,8 @@ struct HdfsScannerParams {
 
     bool use_datacache = false;
     bool enable_populate_datacache = false;
+    // the data with positive priority is always admitted into datacache
+    int32_t datacache_priority = 0;
 
     std::atomic<int32_t>* lazy_column_coalesce_counter;
     bool can_use_any_column = false;
@@ -344,6 +347,8 @@ protected:
     RuntimeState* _runtime_state = nullptr;
     HdfsScanStats _app_stats;
     HdfsScanStats _fs_stats;
+    // io of the prefetch threads, which read the file through a stream of their own
+    HdfsScanStats _prefetch_fs_stats;
     std::unique_ptr<RandomAccessFile> _file;
     // by default it's no compression.
     CompressionTypePB _compression_type = CompressionTypePB::NO_COMPRESSION;
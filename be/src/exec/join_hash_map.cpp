@@ -309,6 +309,7 @@ void JoinHashTable::close() {
 // may be called more than once if spill
 void JoinHashTable::create(const HashTableParam& param) {
     _table_items = std::make_shared<JoinHashTableItems>();
+    _key_columns_prepared = false;
     if (_probe_state == nullptr) {
         _probe_state = std::make_unique<HashTableProbeState>();
         _probe_state->search_ht_timer = param.search_ht_timer;
@@ -436,7 +437,7 @@ int64_t JoinHashTable::mem_usage() const {
     return usage;
 }
 
-Status JoinHashTable::build(RuntimeState* state) {
+Status JoinHashTable::prepare_key_columns() {
     RETURN_IF_ERROR(_table_items->build_chunk->upgrade_if_overflow());
     _table_items->has_large_column = _table_items->build_chunk->has_large_column();
 
@@ -450,6 +451,14 @@ Status JoinHashTable::build(RuntimeState* state) {
     }
 
     RETURN_IF_ERROR(_upgrade_key_columns_if_overflow());
+    _key_columns_prepared = true;
+    return Status::OK();
+}
+
+Status JoinHashTable::build(RuntimeState* state) {
+    if (!_key_columns_prepared) {
+        RETURN_IF_ERROR(prepare_key_columns());
+    }
 
     _hash_map_type = _choose_join_hash_map();
 
@@ -521,6 +530,7 @@ Status JoinHashTable::probe_remain(RuntimeState* state, ChunkPtr* chunk, bool* e
 }
 
 void JoinHashTable::append_chunk(const ChunkPtr& chunk, const Columns& key_columns) {
+    _key_columns_prepared = false;
     Columns& columns = _table_items->build_chunk->columns();
 
     for (size_t i = 0; i < _table_items->build_column_count; i++) {
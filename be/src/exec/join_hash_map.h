@@ -752,6 +752,9 @@ public:
     void create(const HashTableParam& param);
     void close();
 
+    // Finalize the key columns of the appended build rows, runtime filters can be created from them
+    // before the hash map is built. build() calls it unless it's done after the last append_chunk().
+    [[nodiscard]] Status prepare_key_columns();
     [[nodiscard]] Status build(RuntimeState* state);
     void reset_probe_state(RuntimeState* state);
     [[nodiscard]] Status probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk, ChunkPtr* chunk,
@@ -809,6 +812,7 @@ private:
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_LARGEINT)> _fixed128 = nullptr;
 
     JoinHashMapType _hash_map_type = JoinHashMapType::empty;
+    bool _key_columns_prepared = false;
 
     std::shared_ptr<JoinHashTableItems> _table_items;
     std::unique_ptr<HashTableProbeState> _probe_state = std::make_unique<HashTableProbeState>();
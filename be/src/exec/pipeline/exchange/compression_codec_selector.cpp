@@ -0,0 +1,94 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/compression_codec_selector.h"
+
+#include <algorithm>
+
+namespace starrocks::pipeline {
+
+// weight of the newest sample in the moving average of codec stats
+static constexpr double kSampleWeight = 0.5;
+
+CompressionCodecSelector::CompressionCodecSelector(CompressionTypePB initial, int64_t sample_interval)
+        : _candidates({CompressionTypePB::NO_COMPRESSION, CompressionTypePB::LZ4, CompressionTypePB::ZSTD}),
+          _sample_interval(std::max<int64_t>(sample_interval, 1)) {
+    if (std::find(_candidates.begin(), _candidates.end(), initial) == _candidates.end()) {
+        _candidates.push_back(initial);
+    }
+    _stats.resize(_candidates.size());
+    // sending uncompressed data costs nothing but the network
+    _stats[0].sampled = true;
+    _best = _index(initial);
+    _sampling = 1;
+}
+
+size_t CompressionCodecSelector::_index(CompressionTypePB type) const {
+    return std::find(_candidates.begin(), _candidates.end(), type) - _candidates.begin();
+}
+
+CompressionTypePB CompressionCodecSelector::next() {
+    if (_sampling > 0) {
+        return _candidates[_sampling];
+    }
+    if (++_num_chunks > _sample_interval) {
+        _num_chunks = 0;
+        _sampling = 1;
+        return _candidates[_sampling];
+    }
+    return _candidates[_best];
+}
+
+void CompressionCodecSelector::update(CompressionTypePB type, size_t uncompressed_bytes, size_t compressed_bytes,
+                                      int64_t compress_ns) {
+    size_t idx = _index(type);
+    if (idx == 0 || idx >= _candidates.size() || uncompressed_bytes == 0 || compressed_bytes == 0) {
+        return;
+    }
+    double ns_per_byte = static_cast<double>(compress_ns) / uncompressed_bytes;
+    double ratio = static_cast<double>(uncompressed_bytes) / compressed_bytes;
+    auto& stats = _stats[idx];
+    if (stats.sampled) {
+        stats.ns_per_byte = kSampleWeight * ns_per_byte + (1 - kSampleWeight) * stats.ns_per_byte;
+        stats.ratio = kSampleWeight * ratio + (1 - kSampleWeight) * stats.ratio;
+    } else {
+        stats.ns_per_byte = ns_per_byte;
+        stats.ratio = ratio;
+        stats.sampled = true;
+    }
+
+    if (_sampling == idx && ++_sampling == _candidates.size()) {
+        _sampling = 0;
+        _choose();
+    }
+}
+
+double CompressionCodecSelector::_cost(const CodecStats& stats) const {
+    return stats.ns_per_byte + 1e9 / (stats.ratio * _network_bandwidth);
+}
+
+void CompressionCodecSelector::_choose() {
+    if (_network_bandwidth <= 0) {
+        return;
+    }
+    size_t best = 0;
+    for (size_t i = 1; i < _candidates.size(); i++) {
+        if (_stats[i].sampled && _cost(_stats[i]) < _cost(_stats[best])) {
+            best = i;
+        }
+    }
+    _best = best;
+}
+
+} // namespace starrocks::pipeline
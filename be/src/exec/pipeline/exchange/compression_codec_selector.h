@@ -0,0 +1,72 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gen_cpp/types.pb.h"
+
+namespace starrocks::pipeline {
+
+// Pick the compression codec of an exchange channel which minimizes the estimated time to send a byte:
+//   cost = compress_time_per_byte + (1 / compress_ratio) / network_bandwidth
+// The compress cost and ratio of each candidate are measured on real chunks. Every |sample_interval|
+// chunks, each compressing candidate is tried once so that the choice follows the change of data and
+// network. The network bandwidth is fed back by SinkBuffer, the initial codec is used until it is known.
+// Not thread safe, each channel owns its selector.
+class CompressionCodecSelector {
+public:
+    CompressionCodecSelector(CompressionTypePB initial, int64_t sample_interval);
+
+    // The codec to compress the next chunk.
+    CompressionTypePB next();
+
+    // Report the result of compressing |uncompressed_bytes| with |type|.
+    void update(CompressionTypePB type, size_t uncompressed_bytes, size_t compressed_bytes, int64_t compress_ns);
+
+    // Bytes per second, non-positive means unknown.
+    void set_network_bandwidth(int64_t bandwidth) { _network_bandwidth = bandwidth; }
+
+    // The network bandwidth is only used at the end of a round of sampling,
+    // so callers only need to refresh it while sampling.
+    bool is_sampling() const { return _sampling > 0; }
+
+    CompressionTypePB best() const { return _candidates[_best]; }
+
+private:
+    struct CodecStats {
+        double ns_per_byte = 0;
+        double ratio = 1;
+        bool sampled = false;
+    };
+
+    size_t _index(CompressionTypePB type) const;
+    double _cost(const CodecStats& stats) const;
+    void _choose();
+
+    std::vector<CompressionTypePB> _candidates;
+    std::vector<CodecStats> _stats;
+    const int64_t _sample_interval;
+    // chunks sent with the best codec since the last round of sampling
+    int64_t _num_chunks = 0;
+    // index of the candidate to sample next, 0 means not sampling
+    size_t _sampling = 0;
+    size_t _best = 0;
+    int64_t _network_bandwidth = 0;
+};
+
+} // namespace starrocks::pipeline
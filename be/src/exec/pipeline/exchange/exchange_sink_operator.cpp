@@ -35,6 +35,7 @@
 #include "service/brpc.h"
 #include "util/compression/block_compression.h"
 #include "util/compression/compression_utils.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -69,6 +70,10 @@ public:
     Status send_one_chunk(RuntimeState* state, const Chunk* chunk, int32_t driver_sequence, bool eos,
                           bool* is_real_sent);
 
+    // Send one chunk to remote and take over it, so it is handed over to the receiver
+    // without copy if pass through is used.
+    Status send_one_chunk(RuntimeState* state, ChunkUniquePtr chunk, int32_t driver_sequence, bool eos);
+
     // Channel will sent input request directly without batch it.
     // This function is only used when broadcast, because request can be reused
     // by all the channels.
@@ -99,12 +104,18 @@ public:
 
     bool is_local();
 
+    int64_t network_bandwidth() const { return _parent->_buffer->network_bandwidth(_fragment_instance_id); }
+
 private:
     Status _close_internal(RuntimeState* state, FragmentContext* fragment_ctx);
 
     bool _check_use_pass_through();
     void _prepare_pass_through();
 
+    // |owned_chunk| is either null or the owner of |chunk|, which is moved into the pass through buffer.
+    Status _send_one_chunk(RuntimeState* state, const Chunk* chunk, ChunkUniquePtr owned_chunk,
+                           int32_t driver_sequence, bool eos, bool* is_real_sent);
+
     ExchangeSinkOperator* _parent;
 
     const TNetworkAddress _brpc_dest_addr;
@@ -119,6 +130,7 @@ private:
 
     bool _is_first_chunk = true;
     PInternalService_Stub* _brpc_stub = nullptr;
+    std::unique_ptr<CompressionCodecSelector> _codec_selector;
 
     // If pipeline level shuffle is enable, the size of the _chunks
     // equals with dop of dest pipeline
@@ -126,6 +138,7 @@ private:
     // always be 1
     std::vector<std::unique_ptr<Chunk>> _chunks;
     PTransmitChunkParamsPtr _chunk_request;
+    RequestAttachment _attachment;
     size_t _current_request_bytes = 0;
 
     bool _is_inited = false;
@@ -183,6 +196,10 @@ Status ExchangeSinkOperator::Channel::init(RuntimeState* state) {
 
     _prepare_pass_through();
     _ignore_local_data = _enable_exchange_perf && is_local();
+    if (_parent->_adaptive_compression && !_use_pass_through) {
+        _codec_selector = std::make_unique<CompressionCodecSelector>(
+                _parent->_compress_type, config::exchange_adaptive_compression_sample_interval);
+    }
 
     _is_inited = true;
     return Status::OK();
@@ -195,9 +212,16 @@ Status ExchangeSinkOperator::Channel::add_rows_selective(Chunk* chunk, int32_t d
     }
 
     if (_chunks[driver_sequence]->num_rows() + size > state->chunk_size()) {
-        RETURN_IF_ERROR(send_one_chunk(state, _chunks[driver_sequence].get(), driver_sequence, false));
-        // we only clear column data, because we need to reuse column schema
-        _chunks[driver_sequence]->set_num_rows(0);
+        if (_use_pass_through && !_ignore_local_data) {
+            // hand over the full chunk to the receiver in the same process instead of copying it
+            ChunkUniquePtr full_chunk = std::move(_chunks[driver_sequence]);
+            _chunks[driver_sequence] = full_chunk->clone_empty_with_slot(state->chunk_size());
+            RETURN_IF_ERROR(send_one_chunk(state, std::move(full_chunk), driver_sequence, false));
+        } else {
+            RETURN_IF_ERROR(send_one_chunk(state, _chunks[driver_sequence].get(), driver_sequence, false));
+            // we only clear column data, because we need to reuse column schema
+            _chunks[driver_sequence]->set_num_rows(0);
+        }
     }
 
     {
@@ -216,6 +240,20 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
 
 Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const Chunk* chunk, int32_t driver_sequence,
                                                      bool eos, bool* is_real_sent) {
+    return _send_one_chunk(state, chunk, nullptr, driver_sequence, eos, is_real_sent);
+}
+
+Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, ChunkUniquePtr chunk, int32_t driver_sequence,
+                                                     bool eos) {
+    bool is_real_sent = false;
+    const Chunk* raw_chunk = chunk.get();
+    return _send_one_chunk(state, raw_chunk, std::move(chunk), driver_sequence, eos, &is_real_sent);
+}
+
+Status ExchangeSinkOperator::Channel::_send_one_chunk(RuntimeState* state, const Chunk* chunk,
+                                                      ChunkUniquePtr owned_chunk, int32_t driver_sequence, bool eos,
+                                                      bool* is_real_sent) {
+    DCHECK(owned_chunk == nullptr || owned_chunk.get() == chunk);
     *is_real_sent = false;
 
     if (_ignore_local_data && !eos) {
@@ -237,9 +275,14 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
         if (_use_pass_through) {
             size_t chunk_size = serde::ProtobufChunkSerde::max_serialized_size(*chunk);
             // -1 means disable pipeline level shuffle
-            TRY_CATCH_BAD_ALLOC(
-                    _pass_through_context.append_chunk(_parent->_sender_id, chunk, chunk_size,
-                                                       _parent->_is_pipeline_level_shuffle ? driver_sequence : -1));
+            int32_t pass_through_driver_sequence = _parent->_is_pipeline_level_shuffle ? driver_sequence : -1;
+            if (owned_chunk != nullptr) {
+                TRY_CATCH_BAD_ALLOC(_pass_through_context.append_chunk(_parent->_sender_id, std::move(owned_chunk),
+                                                                       chunk_size, pass_through_driver_sequence));
+            } else {
+                TRY_CATCH_BAD_ALLOC(_pass_through_context.append_chunk(_parent->_sender_id, chunk, chunk_size,
+                                                                       pass_through_driver_sequence));
+            }
             _current_request_bytes += chunk_size;
             COUNTER_UPDATE(_parent->_bytes_pass_through_counter, chunk_size);
             COUNTER_SET(_parent->_pass_through_buffer_peak_mem_usage, _pass_through_context.total_bytes());
@@ -247,9 +290,13 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
             if (_parent->_is_pipeline_level_shuffle) {
                 _chunk_request->add_driver_sequences(driver_sequence);
             }
+            if (_codec_selector != nullptr && _codec_selector->is_sampling()) {
+                _codec_selector->set_network_bandwidth(network_bandwidth());
+            }
             auto pchunk = _chunk_request->add_chunks();
-            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk)));
-            _current_request_bytes += pchunk->data().size();
+            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk, 1,
+                                                                         _codec_selector.get(), &_attachment)));
+            _current_request_bytes += pchunk->data_size();
         }
     }
 
@@ -259,9 +306,14 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
         _chunk_request->set_eos(eos);
         _chunk_request->set_use_pass_through(_use_pass_through);
         butil::IOBuf attachment;
-        int64_t attachment_physical_bytes = _parent->construct_brpc_attachment(_chunk_request, attachment);
-        TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub,     std::move(_chunk_request), attachment,
-                                  attachment_physical_bytes,   _brpc_dest_addr};
+        int64_t attachment_physical_bytes = _attachment.release(&attachment);
+        TransmitChunkInfo info = {this->_fragment_instance_id,
+                                  _brpc_stub,
+                                  std::move(_chunk_request),
+                                  attachment,
+                                  attachment_physical_bytes,
+                                  _brpc_dest_addr,
+                                  _use_pass_through ? static_cast<int64_t>(_current_request_bytes) : 0};
         RETURN_IF_ERROR(_parent->_buffer->add_request(info));
         _current_request_bytes = 0;
         _chunk_request.reset();
@@ -306,7 +358,8 @@ Status ExchangeSinkOperator::Channel::_close_internal(RuntimeState* state, Fragm
     if (!fragment_ctx->is_canceled()) {
         for (auto driver_sequence = 0; driver_sequence < _chunks.size(); ++driver_sequence) {
             if (_chunks[driver_sequence] != nullptr) {
-                RETURN_IF_ERROR(res = send_one_chunk(state, _chunks[driver_sequence].get(), driver_sequence, false));
+                RETURN_IF_ERROR(res = send_one_chunk(state, std::move(_chunks[driver_sequence]), driver_sequence,
+                                                     false));
             }
         }
         RETURN_IF_ERROR(res = send_one_chunk(state, nullptr, ExchangeSinkOperator::DEFAULT_DRIVER_SEQUENCE, true));
@@ -405,6 +458,13 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
         _compress_type = CompressionTypePB::LZ4;
     }
     RETURN_IF_ERROR(get_block_compression_codec(_compress_type, &_compress_codec));
+    // Respect the session if it turns off compression.
+    _adaptive_compression =
+            config::exchange_adaptive_compression_enable && _compress_type != CompressionTypePB::NO_COMPRESSION;
+    if (_adaptive_compression) {
+        _codec_selector = std::make_unique<CompressionCodecSelector>(
+                _compress_type, config::exchange_adaptive_compression_sample_interval);
+    }
 
     std::string instances;
     for (const auto& channel : _channels) {
@@ -419,6 +479,9 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     _unique_metrics->add_info_string("DestFragments", instances);
     _unique_metrics->add_info_string("PartType", to_string(_part_type));
     _unique_metrics->add_info_string("ChannelNum", std::to_string(_channels.size()));
+    if (_adaptive_compression) {
+        _unique_metrics->add_info_string("AdaptiveCompression", "true");
+    }
 
     if (_part_type == TPartitionType::HASH_PARTITIONED ||
         _part_type == TPartitionType::BUCKET_SHUFFLE_HASH_PARTITIONED) {
@@ -519,13 +582,25 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
             // 1. create a new chunk PB to serialize
             ChunkPB* pchunk = _chunk_request->add_chunks();
             // 2. serialize input chunk to pchunk
-            TRY_CATCH_BAD_ALLOC(
-                    RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _channels.size())));
-            _current_request_bytes += pchunk->data().size();
+            if (_codec_selector != nullptr && _codec_selector->is_sampling()) {
+                int64_t min_bandwidth = 0;
+                for (auto* channel : _channels) {
+                    if (!channel->use_pass_through()) {
+                        int64_t bandwidth = channel->network_bandwidth();
+                        if (bandwidth > 0 && (min_bandwidth == 0 || bandwidth < min_bandwidth)) {
+                            min_bandwidth = bandwidth;
+                        }
+                    }
+                }
+                _codec_selector->set_network_bandwidth(min_bandwidth);
+            }
+            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _channels.size(),
+                                                                _codec_selector.get(), &_attachment)));
+            _current_request_bytes += pchunk->data_size();
             // 3. if request bytes exceede the threshold, send current request
             if (_current_request_bytes > config::max_transmit_batched_bytes) {
                 butil::IOBuf attachment;
-                int64_t attachment_physical_bytes = construct_brpc_attachment(_chunk_request, attachment);
+                int64_t attachment_physical_bytes = _attachment.release(&attachment);
                 for (auto idx : _channel_indices) {
                     if (!_channels[idx]->use_pass_through()) {
                         PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
@@ -638,7 +713,7 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
 
     if (_chunk_request != nullptr) {
         butil::IOBuf attachment;
-        int64_t attachment_physical_bytes = construct_brpc_attachment(_chunk_request, attachment);
+        int64_t attachment_physical_bytes = _attachment.release(&attachment);
         for (const auto& [_, channel] : _instance_id2channel) {
             PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
             RETURN_IF_ERROR(channel->send_chunk_request(state, copy, attachment, attachment_physical_bytes));
@@ -665,7 +740,8 @@ void ExchangeSinkOperator::close(RuntimeState* state) {
     Operator::close(state);
 }
 
-Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk, int num_receivers) {
+Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk, int num_receivers,
+                                             CompressionCodecSelector* codec_selector, RequestAttachment* attachment) {
     VLOG_ROW << "[ExchangeSinkOperator] serializing " << src->num_rows() << " rows";
     auto send_input_bytes = serde::ProtobufChunkSerde::max_serialized_size(*src, nullptr);
     COUNTER_UPDATE(_sender_input_bytes_counter, send_input_bytes * num_receivers);
@@ -694,64 +770,114 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
     const size_t serialized_size = dst->uncompressed_size();
     COUNTER_UPDATE(_serialized_bytes_counter, serialized_size * num_receivers);
 
-    if (_compress_codec != nullptr && _compress_codec->exceed_max_input_size(serialized_size)) {
+    CompressionTypePB compress_type = _compress_type;
+    const BlockCompressionCodec* compress_codec = _compress_codec;
+    if (codec_selector != nullptr) {
+        compress_type = codec_selector->next();
+        RETURN_IF_ERROR(get_block_compression_codec(compress_type, &compress_codec));
+    }
+
+    if (compress_codec != nullptr && compress_codec->exceed_max_input_size(serialized_size)) {
         return Status::InternalError(strings::Substitute("The input size for compression should be less than $0",
-                                                         _compress_codec->max_input_size()));
+                                                         compress_codec->max_input_size()));
     }
 
     // try compress the ChunkPB data
-    if (_compress_codec != nullptr && serialized_size > 0) {
+    bool compressed_to_attachment = false;
+    if (compress_codec != nullptr && serialized_size > 0) {
         SCOPED_TIMER(_compress_timer);
-
-        if (use_compression_pool(_compress_codec->type())) {
-            Slice compressed_slice;
-            Slice input(dst->data());
-            RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice, true, serialized_size, nullptr,
-                                                      &_compression_scratch));
+        int64_t compress_start = MonotonicNanos();
+        size_t compressed_size = 0;
+
+        if (attachment != nullptr &&
+            static_cast<int64_t>(serialized_size) >= config::exchange_zero_copy_compression_min_bytes) {
+            RETURN_IF_ERROR(_compress_to_attachment(compress_codec, dst, attachment, &compressed_size,
+                                                    &compressed_to_attachment));
+            if (compressed_to_attachment) {
+                dst->set_compress_type(compress_type);
+            }
         } else {
-            int max_compressed_size = _compress_codec->max_compressed_len(serialized_size);
+            if (use_compression_pool(compress_codec->type())) {
+                Slice compressed_slice;
+                Slice input(dst->data());
+                RETURN_IF_ERROR(compress_codec->compress(input, &compressed_slice, true, serialized_size, nullptr,
+                                                         &_compression_scratch));
+            } else {
+                int max_compressed_size = compress_codec->max_compressed_len(serialized_size);
 
-            if (_compression_scratch.size() < max_compressed_size) {
-                _compression_scratch.resize(max_compressed_size);
-            }
+                if (_compression_scratch.size() < max_compressed_size) {
+                    _compression_scratch.resize(max_compressed_size);
+                }
 
-            Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
+                Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
 
-            Slice input(dst->data());
-            RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice));
-            _compression_scratch.resize(compressed_slice.size);
-        }
+                Slice input(dst->data());
+                RETURN_IF_ERROR(compress_codec->compress(input, &compressed_slice));
+                _compression_scratch.resize(compressed_slice.size);
+            }
+            compressed_size = _compression_scratch.size();
 
-        double compress_ratio = (static_cast<double>(serialized_size)) / _compression_scratch.size();
-        if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
-            dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
-            dst->set_compress_type(_compress_type);
+            double compress_ratio = (static_cast<double>(serialized_size)) / compressed_size;
+            if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
+                dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
+                dst->set_compress_type(compress_type);
+            }
+        }
+        if (codec_selector != nullptr) {
+            codec_selector->update(compress_type, serialized_size, compressed_size, MonotonicNanos() - compress_start);
         }
-        COUNTER_UPDATE(_compressed_bytes_counter, _compression_scratch.size() * num_receivers);
-        VLOG_ROW << "uncompressed size: " << serialized_size << ", compressed size: " << _compression_scratch.size();
+        COUNTER_UPDATE(_compressed_bytes_counter, compressed_size * num_receivers);
+        VLOG_ROW << "uncompressed size: " << serialized_size << ", compressed size: " << compressed_size;
     }
-    return Status::OK();
-}
-
-int64_t ExchangeSinkOperator::construct_brpc_attachment(const PTransmitChunkParamsPtr& chunk_request,
-                                                        butil::IOBuf& attachment) {
-    int64_t attachment_physical_bytes = 0;
-    for (int i = 0; i < chunk_request->chunks().size(); ++i) {
-        auto chunk = chunk_request->mutable_chunks(i);
-        chunk->set_data_size(chunk->data().size());
 
+    if (attachment != nullptr && !compressed_to_attachment) {
+        dst->set_data_size(dst->data().size());
         int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
-        attachment.append(chunk->data());
-        attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
-
-        chunk->clear_data();
+        attachment->buf.append(dst->data());
+        attachment->physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
+        dst->clear_data();
+    }
+    if (attachment != nullptr && _is_large_chunk(serialized_size)) {
         // If the request is too big, free the memory in order to avoid OOM
-        if (_is_large_chunk(chunk->data_size())) {
-            chunk->mutable_data()->shrink_to_fit();
-        }
+        dst->mutable_data()->shrink_to_fit();
     }
+    return Status::OK();
+}
 
-    return attachment_physical_bytes;
+Status ExchangeSinkOperator::_compress_to_attachment(const BlockCompressionCodec* codec, ChunkPB* dst,
+                                                     RequestAttachment* attachment, size_t* compressed_size,
+                                                     bool* compressed) {
+    const size_t serialized_size = dst->data().size();
+    const size_t max_compressed_size = codec->max_compressed_len(serialized_size);
+    int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
+    auto* buf = static_cast<char*>(malloc(max_compressed_size));
+    if (buf == nullptr) {
+        return Status::MemoryAllocFailed(strings::Substitute("failed to allocate $0 bytes", max_compressed_size));
+    }
+    Slice compressed_slice{buf, max_compressed_size};
+    Status st = codec->compress(Slice(dst->data()), &compressed_slice);
+    if (!st.ok()) {
+        free(buf);
+        return st;
+    }
+    *compressed_size = compressed_slice.size;
+    double compress_ratio = static_cast<double>(serialized_size) / compressed_slice.size;
+    if (compress_ratio <= config::rpc_compress_ratio_threshold) {
+        free(buf);
+        *compressed = false;
+        return Status::OK();
+    }
+
+    // Give back the unused tail, the buffer lives until the rpc is done.
+    if (auto* shrunk = static_cast<char*>(realloc(buf, compressed_slice.size)); shrunk != nullptr) {
+        buf = shrunk;
+    }
+    attachment->buf.append_user_data(buf, compressed_slice.size, free);
+    attachment->physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
+    dst->set_data_size(compressed_slice.size);
+    dst->clear_data();
+    *compressed = true;
+    return Status::OK();
 }
 
 ExchangeSinkOperatorFactory::ExchangeSinkOperatorFactory(
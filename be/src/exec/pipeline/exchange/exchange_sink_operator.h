@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <butil/iobuf.h>
+
 #include <memory>
 #include <utility>
 
@@ -22,6 +24,7 @@
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exec/data_sink.h"
+#include "exec/pipeline/exchange/compression_codec_selector.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
 #include "exec/pipeline/fragment_context.h"
@@ -32,10 +35,6 @@
 #include "util/raw_container.h"
 #include "util/runtime_profile.h"
 
-namespace butil {
-class IOBuf;
-}
-
 namespace starrocks {
 
 class BlockCompressionCodec;
@@ -77,14 +76,33 @@ public:
 
     void update_metrics(RuntimeState* state) override;
 
+    // The brpc attachment of a chunk request, which holds the data of all the chunks in the request.
+    struct RequestAttachment {
+        butil::IOBuf buf;
+        // bytes allocated by the current thread, which are released by the brpc closure
+        int64_t physical_bytes = 0;
+
+        // Move the data to |attachment| and return its physical bytes.
+        int64_t release(butil::IOBuf* attachment) {
+            attachment->swap(buf);
+            buf.clear();
+            return std::exchange(physical_bytes, 0);
+        }
+    };
+
     // For the first chunk , serialize the chunk data and meta to ChunkPB both.
     // For other chunk, only serialize the chunk data to ChunkPB.
-    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1);
-
-    // Return the physical bytes of attachment.
-    int64_t construct_brpc_attachment(const PTransmitChunkParamsPtr& _chunk_request, butil::IOBuf& attachment);
+    // If |codec_selector| is not null, the compression codec is picked by it instead of the session one.
+    // If |attachment| is not null, the data is moved to the tail of it and only |data_size| is kept in ChunkPB.
+    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1,
+                           CompressionCodecSelector* codec_selector = nullptr, RequestAttachment* attachment = nullptr);
 
 private:
+    // Compress the data of |dst| into a buffer which is handed over to |attachment|, so the compressed data
+    // is sent without being copied again. |*compressed| is false if the compress ratio is too low.
+    Status _compress_to_attachment(const BlockCompressionCodec* codec, ChunkPB* dst, RequestAttachment* attachment,
+                                   size_t* compressed_size, bool* compressed);
+
     bool _is_large_chunk(size_t sz) const {
         // ref olap_scan_node.cpp release_large_columns
         return sz > runtime_state()->chunk_size() * 512;
@@ -159,6 +177,7 @@ private:
 
     // Only used when broadcast
     PTransmitChunkParamsPtr _chunk_request;
+    RequestAttachment _attachment;
     size_t _current_request_bytes = 0;
 
     bool _is_first_chunk = true;
@@ -171,6 +190,10 @@ private:
 
     CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
     const BlockCompressionCodec* _compress_codec = nullptr;
+    // Whether each channel picks its own codec, see CompressionCodecSelector.
+    bool _adaptive_compression = false;
+    // Only used when broadcast, the bandwidth of the slowest channel is used.
+    std::unique_ptr<CompressionCodecSelector> _codec_selector;
 
     RuntimeProfile::Counter* _serialize_chunk_timer = nullptr;
     RuntimeProfile::Counter* _shuffle_hash_timer = nullptr;
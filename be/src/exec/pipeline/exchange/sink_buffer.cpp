@@ -20,7 +20,11 @@
 #include <string_view>
 
 #include "fmt/core.h"
+#include "runtime/data_stream_mgr.h"
+#include "runtime/exec_env.h"
+#include "util/bthreads/util.h"
 #include "util/defer_op.h"
+#include "util/failpoint/fail_point.h"
 #include "util/time.h"
 #include "util/uid_util.h"
 
@@ -32,6 +36,7 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
           _mem_tracker(fragment_ctx->runtime_state()->instance_mem_tracker()),
           _brpc_timeout_ms(fragment_ctx->runtime_state()->query_options().query_timeout * 1000),
           _is_dest_merge(is_dest_merge),
+          _enable_credit_flow_control(config::enable_exchange_credit_flow_control),
           _rpc_http_min_size(fragment_ctx->runtime_state()->get_rpc_http_min_size()),
           _sent_audit_stats_frequency_upper_limit(
                   std::max((int64_t)64, BitUtil::RoundUpToPowerOfTwo(fragment_ctx->num_drivers() * 4))) {
@@ -54,6 +59,9 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _network_times[instance_id.lo] = TimeTrace{};
             _mutexes[instance_id.lo] = std::make_unique<Mutex>();
             _dest_addrs[instance_id.lo] = dest.brpc_server;
+            _credits[instance_id.lo] = -1;
+            _in_flight_bytes[instance_id.lo] = 0;
+            _credit_starved_since[instance_id.lo] = -1;
 
             PUniqueId finst_id;
             finst_id.set_hi(instance_id.hi);
@@ -169,6 +177,13 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
     COUNTER_SET(wait_timer, _full_time);
     COUNTER_UPDATE(wait_timer, MonotonicNanos() - _pending_timestamp);
 
+    if (_enable_credit_flow_control) {
+        auto* credit_starved_timer = ADD_TIMER(profile, "CreditStarvedTime");
+        auto* credit_starved_counter = ADD_COUNTER(profile, "CreditStarvedCount", TUnit::UNIT);
+        COUNTER_SET(credit_starved_timer, _credit_starved_time);
+        COUNTER_SET(credit_starved_counter, _credit_starved_count);
+    }
+
     auto* bytes_sent_counter = ADD_COUNTER(profile, "BytesSent", TUnit::BYTES);
     auto* request_sent_counter = ADD_COUNTER(profile, "RequestSent", TUnit::UNIT);
     COUNTER_SET(bytes_sent_counter, _bytes_sent);
@@ -196,10 +211,7 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
 int64_t SinkBuffer::_network_time() {
     int64_t max = 0;
     for (auto& [_, time_trace] : _network_times) {
-        double average_concurrency =
-                static_cast<double>(time_trace.accumulated_concurrency) / std::max(1, time_trace.times);
-        int64_t average_accumulated_time =
-                static_cast<int64_t>(time_trace.accumulated_time / std::max(1.0, average_concurrency));
+        int64_t average_accumulated_time = time_trace.average_time();
         if (average_accumulated_time > max) {
             max = average_accumulated_time;
         }
@@ -207,6 +219,20 @@ int64_t SinkBuffer::_network_time() {
     return max;
 }
 
+int64_t SinkBuffer::network_bandwidth(const TUniqueId& instance_id) {
+    auto it = _mutexes.find(instance_id.lo);
+    if (it == _mutexes.end()) {
+        return 0;
+    }
+    std::lock_guard<Mutex> l(*it->second);
+    const auto& time_trace = _network_times[instance_id.lo];
+    int64_t average_time = time_trace.average_time();
+    if (average_time <= 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(time_trace.accumulated_bytes * 1e9 / average_time);
+}
+
 void SinkBuffer::cancel_one_sinker(RuntimeState* const state) {
     if (--_num_uncancelled_sinkers == 0) {
         _is_finishing = true;
@@ -247,12 +273,12 @@ void SinkBuffer::cancel_one_sinker(RuntimeState* const state) {
 }
 
 void SinkBuffer::_update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                                      const int64_t receiver_post_process_time) {
+                                      const int64_t receiver_post_process_time, const int64_t bytes) {
     const int64_t get_response_timestamp = MonotonicNanos();
     _last_receive_time = get_response_timestamp;
     int32_t concurrency = _num_in_flight_rpcs[instance_id.lo];
     int64_t time_usage = get_response_timestamp - send_timestamp - receiver_post_process_time;
-    _network_times[instance_id.lo].update(time_usage, concurrency);
+    _network_times[instance_id.lo].update(time_usage, concurrency, bytes);
     _rpc_cumulative_time += time_usage;
     _rpc_count++;
 }
@@ -273,6 +299,43 @@ void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_
     }
 }
 
+int64_t SinkBuffer::_credit_bytes_of(const TransmitChunkInfo& request) {
+    int64_t bytes = request.pass_through_bytes;
+    for (const auto& pchunk : request.params->chunks()) {
+        bytes += pchunk.data_size();
+    }
+    return bytes;
+}
+
+bool SinkBuffer::_is_credit_starved(const TUniqueId& instance_id, const int64_t request_bytes) {
+    if (!_enable_credit_flow_control) {
+        return false;
+    }
+    int64_t credit = _credits[instance_id.lo];
+    int64_t in_flight_bytes = _in_flight_bytes[instance_id.lo];
+    auto& starved_since = _credit_starved_since[instance_id.lo];
+    if (credit < 0 || _num_in_flight_rpcs[instance_id.lo] == 0 || in_flight_bytes + request_bytes <= credit) {
+        if (starved_since != -1) {
+            _credit_starved_time += MonotonicNanos() - starved_since;
+            starved_since = -1;
+        }
+        return false;
+    }
+    if (starved_since == -1) {
+        starved_since = MonotonicNanos();
+        ++_credit_starved_count;
+    }
+    return true;
+}
+
+void SinkBuffer::_release_credit(const TUniqueId& instance_id, const int64_t bytes,
+                                 const PTransmitChunkResult* result) {
+    _in_flight_bytes[instance_id.lo] -= bytes;
+    if (result != nullptr && result->has_credit_bytes()) {
+        _credits[instance_id.lo] = result->credit_bytes();
+    }
+}
+
 Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::function<void()>& pre_works) {
     std::lock_guard<Mutex> l(*_mutexes[instance_id.lo]);
     pre_works();
@@ -303,6 +366,10 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
         }
 
         TransmitChunkInfo& request = buffer.front();
+        const int64_t credit_bytes = _enable_credit_flow_control ? _credit_bytes_of(request) : 0;
+        if (_is_credit_starved(instance_id, credit_bytes)) {
+            return Status::OK();
+        }
         bool need_wait = false;
         DeferOp pop_defer([&need_wait, &buffer, mem_tracker = _mem_tracker]() {
             if (need_wait) {
@@ -366,7 +433,8 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
         }
 
         auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(
-                {instance_id, request.params->sequence(), MonotonicNanos()});
+                {instance_id, request.params->sequence(), MonotonicNanos(),
+                 static_cast<int64_t>(request.attachment.size()), credit_bytes});
         if (_first_send_time == -1) {
             _first_send_time = MonotonicNanos();
         }
@@ -378,6 +446,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
+                _release_credit(ctx.instance_id, ctx.credit_bytes, nullptr);
             }
 
             const auto& dest_addr = _dest_addrs[ctx.instance_id.lo];
@@ -396,6 +465,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
+                _release_credit(ctx.instance_id, ctx.credit_bytes, &result);
             }
             if (!status.ok()) {
                 _is_finishing = true;
@@ -407,7 +477,8 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                                             status.message());
             } else {
                 static_cast<void>(_try_to_send_rpc(ctx.instance_id, [&]() {
-                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receiver_post_process_time());
+                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receiver_post_process_time(),
+                                         ctx.bytes);
                     _process_send_window(ctx.instance_id, ctx.sequence);
                 }));
             }
@@ -415,6 +486,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
 
         ++_total_in_flight_rpc;
         ++_num_in_flight_rpcs[instance_id.lo];
+        _in_flight_bytes[instance_id.lo] += credit_bytes;
 
         // Attachment will be released by process_mem_tracker in closure->Run() in bthread, when receiving the response,
         // so decrease the memory usage of attachment from instance_mem_tracker immediately before sending the request.
@@ -439,8 +511,70 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
     return Status::OK();
 }
 
+// Set receiver_post_process_time and the credit like the brpc service does. The receiver may hold
+// the closure and run it later when its buffer is not full, so the request is kept until then.
+class InProcessTransmitClosure final : public google::protobuf::Closure {
+public:
+    InProcessTransmitClosure(google::protobuf::Closure* done, PTransmitChunkResult* result,
+                             PTransmitChunkParamsPtr params)
+            : _done(done), _result(result), _params(std::move(params)) {}
+
+    void Run() override {
+        std::unique_ptr<InProcessTransmitClosure> self_guard(this);
+        _result->set_receiver_post_process_time(MonotonicNanos() - _receive_timestamp);
+        TUniqueId finst_id;
+        finst_id.hi = _params->finst_id().hi();
+        finst_id.lo = _params->finst_id().lo();
+        ExecEnv::GetInstance()->stream_mgr()->set_credit_bytes(finst_id, _params->node_id(), _result);
+        _done->Run();
+    }
+
+private:
+    google::protobuf::Closure* _done;
+    PTransmitChunkResult* _result;
+    PTransmitChunkParamsPtr _params;
+    const int64_t _receive_timestamp = MonotonicNanos();
+};
+
+DEFINE_FAIL_POINT(sink_buffer_start_in_process_transmit_failed);
+
+bool SinkBuffer::_transmit_in_process(DisposableClosure<PTransmitChunkResult, ClosureContext>* closure,
+                                      const TransmitChunkInfo& request) {
+    FAIL_POINT_TRIGGER_EXECUTE(sink_buffer_start_in_process_transmit_failed, {
+        LOG(WARNING) << "fall back to brpc for pass through request: injected failure";
+        return false;
+    });
+    // The chunks of a pass through request have been put into PassThroughChunkBuffer, the request only
+    // notifies the receiver to pull them. It runs in a bthread since the receiver may run the closure
+    // immediately, which would send the next request recursively.
+    PTransmitChunkParamsPtr params = request.params;
+    auto res = bthreads::start_bthread([closure, params]() {
+        Status::OK().to_protobuf(closure->result.mutable_status());
+        google::protobuf::Closure* done = new InProcessTransmitClosure(closure, &closure->result, params);
+        Status st = ExecEnv::GetInstance()->stream_mgr()->transmit_chunk(*params, &done);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to transmit chunk in process, fragment_instance_id="
+                         << print_id(params->finst_id()) << ", node=" << params->node_id() << ", " << st;
+            st.to_protobuf(closure->result.mutable_status());
+        }
+        if (done != nullptr) {
+            done->Run();
+        }
+    });
+    if (!res.ok()) {
+        LOG(WARNING) << "fall back to brpc for pass through request: " << res.status();
+        return false;
+    }
+    return true;
+}
+
 Status SinkBuffer::_send_rpc(DisposableClosure<PTransmitChunkResult, ClosureContext>* closure,
                              const TransmitChunkInfo& request) {
+    // Broadcast requests may carry serialized chunks even if pass through is used.
+    if (request.params->use_pass_through() && request.params->chunks_size() == 0 &&
+        config::enable_exchange_pass_through_bypass_brpc && _transmit_in_process(closure, request)) {
+        return Status::OK();
+    }
     auto expected_iobuf_size = request.attachment.size() + request.params->ByteSizeLong() + sizeof(size_t) * 2;
     if (UNLIKELY(expected_iobuf_size > _rpc_http_min_size)) {
         butil::IOBuf iobuf;
@@ -42,6 +42,9 @@ struct ClosureContext {
     TUniqueId instance_id;
     int64_t sequence;
     int64_t send_timestamp;
+    int64_t bytes;
+    // The bytes charged against the credit of the destination.
+    int64_t credit_bytes;
 };
 
 struct TransmitChunkInfo {
@@ -54,6 +57,8 @@ struct TransmitChunkInfo {
     butil::IOBuf attachment;
     int64_t attachment_physical_bytes;
     const TNetworkAddress brpc_addr;
+    // The bytes of the chunks handed over through the pass through buffer for this request.
+    int64_t pass_through_bytes = 0;
 };
 
 // TimeTrace is introduced to estimate time more accurately.
@@ -61,6 +66,7 @@ struct TransmitChunkInfo {
 // 1. times will be increased by 1.
 // 2. sample time will be accumulated to accumulated_time.
 // 3. sample concurrency will be accumulated to accumulated_concurrency.
+// 4. sample bytes will be accumulated to accumulated_bytes.
 // So we can get the average time of each direction by
 // `average_concurrency = accumulated_concurrency / times`
 // `average_time = accumulated_time / average_concurrency`
@@ -68,11 +74,18 @@ struct TimeTrace {
     int32_t times = 0;
     int64_t accumulated_time = 0;
     int32_t accumulated_concurrency = 0;
+    int64_t accumulated_bytes = 0;
 
-    void update(int64_t time, int32_t concurrency) {
+    void update(int64_t time, int32_t concurrency, int64_t bytes) {
         times++;
         accumulated_time += time;
         accumulated_concurrency += concurrency;
+        accumulated_bytes += bytes;
+    }
+
+    int64_t average_time() const {
+        double average_concurrency = static_cast<double>(accumulated_concurrency) / std::max(1, times);
+        return static_cast<int64_t>(accumulated_time / std::max(1.0, average_concurrency));
     }
 };
 
@@ -98,17 +111,27 @@ public:
 
     void incr_sinker(RuntimeState* state);
 
+    // Estimated network bandwidth to the destination in bytes per second, 0 if nothing has been sent yet.
+    int64_t network_bandwidth(const TUniqueId& instance_id);
+
 private:
     using Mutex = bthread::Mutex;
 
     void _update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                              const int64_t receiver_post_process_time);
+                              const int64_t receiver_post_process_time, const int64_t bytes);
     // Update the discontinuous acked window, here are the invariants:
     // all acks received with sequence from [0, _max_continuous_acked_seqs[x]]
     // not all the acks received with sequence from [_max_continuous_acked_seqs[x]+1, _request_seqs[x]]
     // _discontinuous_acked_seqs[x] stored the received discontinuous acks
     void _process_send_window(const TUniqueId& instance_id, const int64_t sequence);
 
+    // The bytes the receiver buffers for the request, including the serialized chunks in the attachment
+    // or in the protobuf, and the chunks handed over by pass through.
+    static int64_t _credit_bytes_of(const TransmitChunkInfo& request);
+    // Return true if the request must wait for more credit of the destination.
+    bool _is_credit_starved(const TUniqueId& instance_id, const int64_t request_bytes);
+    void _release_credit(const TUniqueId& instance_id, const int64_t bytes, const PTransmitChunkResult* result);
+
     // Try to send rpc if buffer is not empty and channel is not busy
     // And we need to put this function and other extra works(pre_works) together as an atomic operation
     [[nodiscard]] Status _try_to_send_rpc(const TUniqueId& instance_id, const std::function<void()>& pre_works);
@@ -116,6 +139,11 @@ private:
     // send by rpc or http
     Status _send_rpc(DisposableClosure<PTransmitChunkResult, ClosureContext>* closure, const TransmitChunkInfo& req);
 
+    // Deliver a pass through request to the receiver in the same process without brpc.
+    // Return false if it can not be delivered in process.
+    bool _transmit_in_process(DisposableClosure<PTransmitChunkResult, ClosureContext>* closure,
+                              const TransmitChunkInfo& req);
+
     // Roughly estimate network time which is defined as the time between sending a and receiving a packet,
     // and the processing time of both sides are excluded
     // For each destination, we may send multiply packages at the same time, and the time is
@@ -128,6 +156,7 @@ private:
     MemTracker* const _mem_tracker;
     const int32_t _brpc_timeout_ms;
     const bool _is_dest_merge;
+    const bool _enable_credit_flow_control;
 
     /// Taking into account of efficiency, all the following maps
     /// use int64_t as key, which is the field type of TUniqueId::lo
@@ -157,6 +186,13 @@ private:
     phmap::flat_hash_map<int64_t, TimeTrace> _network_times;
     phmap::flat_hash_map<int64_t, std::unique_ptr<Mutex>> _mutexes;
     phmap::flat_hash_map<int64_t, TNetworkAddress> _dest_addrs;
+    // Credit based flow control, a destination is sent to only if its in-flight bytes are within the credit
+    // granted by the latest response, or nothing is in flight, so that the credit can always be refreshed.
+    // -1 means the receiver hasn't granted any credit.
+    phmap::flat_hash_map<int64_t, int64_t> _credits;
+    phmap::flat_hash_map<int64_t, int64_t> _in_flight_bytes;
+    // The time since when the destination has pending requests but no credit, -1 if not starved.
+    phmap::flat_hash_map<int64_t, int64_t> _credit_starved_since;
 
     // True means that SinkBuffer needn't input chunk and send chunk anymore,
     // but there may be still in-flight RPC running.
@@ -183,6 +219,8 @@ private:
     int64_t _pending_timestamp = -1;
     mutable std::atomic<int64_t> _last_full_timestamp = -1;
     mutable std::atomic<int64_t> _full_time = 0;
+    std::atomic<int64_t> _credit_starved_time = 0;
+    std::atomic<int64_t> _credit_starved_count = 0;
 
     // These two fields are used to calculate the overthroughput
     // Non-atomic type is enough because the concurrency inconsistency is acceptable
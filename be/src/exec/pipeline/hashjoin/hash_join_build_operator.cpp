@@ -80,7 +80,9 @@ Status HashJoinBuildOperator::set_finishing(RuntimeState* state) {
     if (state->is_cancelled()) {
         return Status::Cancelled("runtime state is cancelled");
     }
-    RETURN_IF_ERROR(_join_builder->build_ht(state));
+    // Runtime filters only depend on the build keys, publish them before building the hash table,
+    // so that the probe side can use them earlier.
+    RETURN_IF_ERROR(_join_builder->prepare_build_key_columns());
 
     size_t merger_index = _driver_sequence;
     // Broadcast Join only has one build operator.
@@ -123,6 +125,8 @@ Status HashJoinBuildOperator::set_finishing(RuntimeState* state) {
                                                                    std::move(in_filters), std::move(bloom_filters)));
     }
 
+    RETURN_IF_ERROR(_join_builder->build_ht(state));
+
     _join_builder->enter_probe_phase();
 
     return Status::OK();
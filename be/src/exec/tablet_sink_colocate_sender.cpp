@@ -55,9 +55,14 @@ Status TabletSinkColocateSender::send_chunk(const OlapTableSchemaParam* schema,
         for (size_t i = 0; i < index_size; ++i) {
             _index_tablet_ids[i].resize(num_rows);
             auto* index = schema->indexes()[i];
+            auto& partition_ids = index_id_partition_id[index->index_id];
+            const OlapTablePartition* last_partition = nullptr;
             for (size_t j = 0; j < selection_size; ++j) {
                 uint16_t selection = validate_select_idx[j];
-                index_id_partition_id[index->index_id].emplace(partitions[selection]->id);
+                if (partitions[selection] != last_partition) {
+                    last_partition = partitions[selection];
+                    partition_ids.emplace(last_partition->id);
+                }
                 _index_tablet_ids[i][selection] = partitions[selection]->indexes[i].tablets[tablet_indexes[selection]];
             }
         }
@@ -68,8 +73,13 @@ Status TabletSinkColocateSender::send_chunk(const OlapTableSchemaParam* schema,
         for (size_t i = 0; i < index_size; ++i) {
             auto* index = schema->indexes()[i];
             _index_tablet_ids[i].resize(num_rows);
+            auto& partition_ids = index_id_partition_id[index->index_id];
+            const OlapTablePartition* last_partition = nullptr;
             for (size_t j = 0; j < num_rows; ++j) {
-                index_id_partition_id[index->index_id].emplace(partitions[j]->id);
+                if (partitions[j] != last_partition) {
+                    last_partition = partitions[j];
+                    partition_ids.emplace(last_partition->id);
+                }
                 _index_tablet_ids[i][j] = partitions[j]->indexes[i].tablets[tablet_indexes[j]];
             }
         }
@@ -88,45 +98,31 @@ Status TabletSinkColocateSender::_send_chunks(const OlapTableSchemaParam* schema
     DCHECK(_index_id_to_tablet_be_map.find(index->index_id) != _index_id_to_tablet_be_map.end());
     auto& tablet_to_bes = _index_id_to_tablet_be_map.find(index->index_id)->second;
 
+    // compute the selection of all the nodes in one pass
+    _node_positions.clear();
     for (auto& it : _node_channels) {
-        _node_select_idx.clear();
-        _node_select_idx.reserve(selection_idx.size());
-
-        auto* node = it.second;
-        if (_is_failed_channel(node)) {
+        if (_is_failed_channel(it.second)) {
             // skip open fail channel
             continue;
         }
-        bool has_send_data = false;
-        if (_enable_replicated_storage) {
-            for (unsigned short selection : selection_idx) {
-                auto choose_tablet_id = tablet_id_selections[selection];
-                DCHECK(tablet_to_bes.find(choose_tablet_id) != tablet_to_bes.end());
-                auto& be_ids = tablet_to_bes.find(choose_tablet_id)->second;
-                DCHECK_LT(0, be_ids.size());
-                // TODO(meegoo): add backlist policy
-                // first replica is primary replica, which determined by FE now
-                // only send to primary replica when enable replicated storage engine
-                // NOTE: FE will keep all indexes' primary tablet is in the same node.
-                if (be_ids[0] == node->node_id()) {
-                    _node_select_idx.emplace_back(selection);
-                    has_send_data = true;
-                }
-            }
-        } else {
-            auto& node_tablet_ids = node->tablet_ids_of_index(index->index_id);
-            for (unsigned short selection : selection_idx) {
-                auto choose_tablet_id = tablet_id_selections[selection];
-                if (node_tablet_ids.find(choose_tablet_id) != node_tablet_ids.end()) {
-                    _node_select_idx.emplace_back(selection);
-                    has_send_data = true;
-                }
-            }
+        _node_positions.emplace(it.first, _node_positions.size());
+    }
+    _node_select_idxes.resize(_node_positions.size());
+    // NOTE: FE will keep all indexes' primary tablet is in the same node.
+    route_rows_to_nodes(tablet_id_selections, selection_idx, tablet_to_bes, _node_positions,
+                        _enable_replicated_storage, &_node_select_idxes);
+
+    for (auto& it : _node_channels) {
+        auto pos = _node_positions.find(it.first);
+        if (pos == _node_positions.end()) {
+            continue;
         }
-        if (!has_send_data) {
+        auto& node_select_idx = _node_select_idxes[pos->second];
+        if (node_select_idx.empty()) {
             continue;
         }
-        auto st = node->add_chunks(chunk, index_tablet_ids, _node_select_idx, 0, _node_select_idx.size());
+        auto* node = it.second;
+        auto st = node->add_chunks(chunk, index_tablet_ids, node_select_idx, 0, node_select_idx.size());
 
         if (!st.ok()) {
             LOG(WARNING) << node->name() << ", tablet add chunk failed, " << node->print_load_info()
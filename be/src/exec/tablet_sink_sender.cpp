@@ -54,9 +54,14 @@ Status TabletSinkSender::send_chunk(const OlapTableSchemaParam* schema,
         size_t index_size = partitions[validate_select_idx[0]]->indexes.size();
         for (size_t i = 0; i < index_size; ++i) {
             auto* index = schema->indexes()[i];
+            auto& partition_ids = index_id_partition_id[index->index_id];
+            const OlapTablePartition* last_partition = nullptr;
             for (size_t j = 0; j < selection_size; ++j) {
                 uint16_t selection = validate_select_idx[j];
-                index_id_partition_id[index->index_id].emplace(partitions[selection]->id);
+                if (partitions[selection] != last_partition) {
+                    last_partition = partitions[selection];
+                    partition_ids.emplace(last_partition->id);
+                }
                 _tablet_ids[selection] = partitions[selection]->indexes[i].tablets[tablet_indexes[selection]];
             }
             RETURN_IF_ERROR(_send_chunk_by_node(chunk, _channels[i], validate_select_idx));
@@ -65,8 +70,13 @@ Status TabletSinkSender::send_chunk(const OlapTableSchemaParam* schema,
         size_t index_size = partitions[0]->indexes.size();
         for (size_t i = 0; i < index_size; ++i) {
             auto* index = schema->indexes()[i];
+            auto& partition_ids = index_id_partition_id[index->index_id];
+            const OlapTablePartition* last_partition = nullptr;
             for (size_t j = 0; j < num_rows; ++j) {
-                index_id_partition_id[index->index_id].emplace(partitions[j]->id);
+                if (partitions[j] != last_partition) {
+                    last_partition = partitions[j];
+                    partition_ids.emplace(last_partition->id);
+                }
                 _tablet_ids[j] = partitions[j]->indexes[i].tablets[tablet_indexes[j]];
             }
             RETURN_IF_ERROR(_send_chunk_by_node(chunk, _channels[i], validate_select_idx));
@@ -75,46 +85,77 @@ Status TabletSinkSender::send_chunk(const OlapTableSchemaParam* schema,
     return Status::OK();
 }
 
+void TabletSinkSender::route_rows_to_nodes(const std::vector<int64_t>& tablet_ids,
+                                           const std::vector<uint16_t>& selection_idx,
+                                           const std::unordered_map<int64_t, std::vector<int64_t>>& tablet_to_be,
+                                           const std::unordered_map<int64_t, size_t>& node_positions,
+                                           bool primary_replica_only,
+                                           std::vector<std::vector<uint32_t>>* node_selections) {
+    for (auto& selection : *node_selections) {
+        selection.clear();
+        selection.reserve(selection_idx.size());
+    }
+    // rows of the same tablet are often adjacent, e.g. random distribution or few buckets,
+    // so cache the backends of the last tablet to skip the lookup
+    int64_t last_tablet_id = -1;
+    const std::vector<int64_t>* be_ids = nullptr;
+    for (uint16_t selection : selection_idx) {
+        int64_t tablet_id = tablet_ids[selection];
+        if (be_ids == nullptr || tablet_id != last_tablet_id) {
+            auto iter = tablet_to_be.find(tablet_id);
+            DCHECK(iter != tablet_to_be.end());
+            be_ids = &iter->second;
+            last_tablet_id = tablet_id;
+            DCHECK_LT(0, be_ids->size());
+        }
+        if (primary_replica_only) {
+            // TODO(meegoo): add backlist policy
+            // first replica is primary replica, which determined by FE now
+            // only send to primary replica when enable replicated storage engine
+            auto pos = node_positions.find((*be_ids)[0]);
+            if (pos != node_positions.end()) {
+                (*node_selections)[pos->second].emplace_back(selection);
+            }
+        } else {
+            for (int64_t be_id : *be_ids) {
+                auto pos = node_positions.find(be_id);
+                if (pos != node_positions.end()) {
+                    (*node_selections)[pos->second].emplace_back(selection);
+                }
+            }
+        }
+    }
+}
+
 Status TabletSinkSender::_send_chunk_by_node(Chunk* chunk, IndexChannel* channel,
                                              const std::vector<uint16_t>& selection_idx) {
     Status err_st = Status::OK();
 
     DCHECK(_index_id_to_tablet_be_map.find(channel->index_id()) != _index_id_to_tablet_be_map.end());
     auto& tablet_to_be = _index_id_to_tablet_be_map.find(channel->index_id())->second;
+
+    // compute the selection of all the nodes in one pass
+    _node_positions.clear();
     for (auto& it : channel->_node_channels) {
-        NodeChannel* node = it.second.get();
-        if (channel->is_failed_channel(node)) {
+        if (channel->is_failed_channel(it.second.get())) {
             // skip open fail channel
             continue;
         }
-        int64_t be_id = it.first;
-        _node_select_idx.clear();
-        _node_select_idx.reserve(selection_idx.size());
-
-        if (_enable_replicated_storage) {
-            for (unsigned short selection : selection_idx) {
-                DCHECK(tablet_to_be.find(_tablet_ids[selection]) != tablet_to_be.end());
-                std::vector<int64_t>& be_ids = tablet_to_be.find(_tablet_ids[selection])->second;
-                DCHECK_LT(0, be_ids.size());
-                // TODO(meegoo): add backlist policy
-                // first replica is primary replica, which determined by FE now
-                // only send to primary replica when enable replicated storage engine
-                if (be_ids[0] == be_id) {
-                    _node_select_idx.emplace_back(selection);
-                }
-            }
-        } else {
-            for (unsigned short selection : selection_idx) {
-                DCHECK(tablet_to_be.find(_tablet_ids[selection]) != tablet_to_be.end());
-                std::vector<int64_t>& be_ids = tablet_to_be.find(_tablet_ids[selection])->second;
-                DCHECK_LT(0, be_ids.size());
-                if (std::find(be_ids.begin(), be_ids.end(), be_id) != be_ids.end()) {
-                    _node_select_idx.emplace_back(selection);
-                }
-            }
+        _node_positions.emplace(it.first, _node_positions.size());
+    }
+    _node_select_idxes.resize(_node_positions.size());
+    route_rows_to_nodes(_tablet_ids, selection_idx, tablet_to_be, _node_positions, _enable_replicated_storage,
+                        &_node_select_idxes);
+
+    for (auto& it : channel->_node_channels) {
+        NodeChannel* node = it.second.get();
+        auto pos = _node_positions.find(it.first);
+        if (pos == _node_positions.end()) {
+            continue;
         }
+        auto& node_select_idx = _node_select_idxes[pos->second];
 
-        auto st = node->add_chunk(chunk, _tablet_ids, _node_select_idx, 0, _node_select_idx.size());
+        auto st = node->add_chunk(chunk, _tablet_ids, node_select_idx, 0, node_select_idx.size());
 
         if (!st.ok()) {
             LOG(WARNING) << node->name() << ", tablet add chunk failed, " << node->print_load_info()
@@ -63,6 +63,15 @@ public:
         }
     }
 
+    // Route the rows in |selection_idx| to the backends holding their tablets in a single pass, the backends of
+    // a tablet are looked up once per row instead of once per row and backend.
+    // |node_positions| maps a backend id to the index of its selection in |node_selections|, backends not in it
+    // are skipped. If |primary_replica_only| is true, rows are only routed to the first replica of the tablet.
+    static void route_rows_to_nodes(const std::vector<int64_t>& tablet_ids, const std::vector<uint16_t>& selection_idx,
+                                    const std::unordered_map<int64_t, std::vector<int64_t>>& tablet_to_be,
+                                    const std::unordered_map<int64_t, size_t>& node_positions,
+                                    bool primary_replica_only, std::vector<std::vector<uint32_t>>* node_selections);
+
 protected:
     Status _send_chunk_by_node(Chunk* chunk, IndexChannel* channel, const std::vector<uint16_t>& selection_idx);
 
@@ -96,8 +105,9 @@ protected:
 
     bool _open_done = false;
     bool _close_done = false;
-    // one chunk selection for BE node
-    std::vector<uint32_t> _node_select_idx;
+    // one chunk selection for each BE node, indexed by _node_positions
+    std::vector<std::vector<uint32_t>> _node_select_idxes;
+    std::unordered_map<int64_t, size_t> _node_positions;
     std::vector<int64_t> _tablet_ids;
     std::set<int64_t> _failed_channels;
 };
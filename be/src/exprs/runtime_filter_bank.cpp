@@ -31,6 +31,7 @@
 #include "simd/simd.h"
 #include "types/logical_type.h"
 #include "types/logical_type_infra.h"
+#include "util/compression/block_compression.h"
 #include "util/time.h"
 
 namespace starrocks {
@@ -111,6 +112,52 @@ int RuntimeFilterHelper::deserialize_runtime_filter(ObjectPool* pool, JoinRuntim
     return version;
 }
 
+void RuntimeFilterHelper::compress_runtime_filter(PTransmitRuntimeFilterParams* params, int64_t min_bytes) {
+    const std::string& data = params->data();
+    if (min_bytes <= 0 || data.size() < static_cast<size_t>(min_bytes)) {
+        return;
+    }
+    const BlockCompressionCodec* codec = nullptr;
+    if (!get_block_compression_codec(CompressionTypePB::LZ4, &codec).ok() || codec == nullptr ||
+        codec->exceed_max_input_size(data.size())) {
+        return;
+    }
+    std::string compressed;
+    compressed.resize(codec->max_compressed_len(data.size()));
+    Slice output(compressed.data(), compressed.size());
+    if (!codec->compress(Slice(data), &output).ok()) {
+        return;
+    }
+    // dense filters hardly compress, not worth decompressing them on every receiver.
+    if (output.size > data.size() * 9 / 10) {
+        return;
+    }
+    compressed.resize(output.size);
+    params->set_uncompressed_size(data.size());
+    params->set_compression_type(CompressionTypePB::LZ4);
+    params->mutable_data()->swap(compressed);
+}
+
+StatusOr<Slice> RuntimeFilterHelper::get_runtime_filter_data(const PTransmitRuntimeFilterParams& params,
+                                                             std::string* buffer) {
+    const std::string& data = params.data();
+    if (!params.has_compression_type() || params.compression_type() == CompressionTypePB::NO_COMPRESSION) {
+        return Slice(data);
+    }
+    const BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(params.compression_type(), &codec));
+    if (codec == nullptr) {
+        return Status::InternalError("unknown runtime filter compression type");
+    }
+    buffer->resize(params.uncompressed_size());
+    Slice output(buffer->data(), buffer->size());
+    RETURN_IF_ERROR(codec->decompress(Slice(data), &output));
+    if (output.size != buffer->size()) {
+        return Status::Corruption("runtime filter decompressed size mismatch");
+    }
+    return output;
+}
+
 JoinRuntimeFilter* RuntimeFilterHelper::create_runtime_bloom_filter(ObjectPool* pool, LogicalType type) {
     JoinRuntimeFilter* filter = create_join_runtime_filter(pool, type);
     return filter;
@@ -52,6 +52,10 @@ public:
     static size_t serialize_runtime_filter(int serialize_version, const JoinRuntimeFilter* rf, uint8_t* data);
     static int deserialize_runtime_filter(ObjectPool* pool, JoinRuntimeFilter** rf, const uint8_t* data, size_t size);
     static JoinRuntimeFilter* create_join_runtime_filter(ObjectPool* pool, LogicalType type);
+    // Compress the serialized runtime filter in params with LZ4 if it's at least min_bytes and compresses well.
+    static void compress_runtime_filter(PTransmitRuntimeFilterParams* params, int64_t min_bytes);
+    // Get the serialized runtime filter in params, which is decompressed into buffer if it's compressed.
+    static StatusOr<Slice> get_runtime_filter_data(const PTransmitRuntimeFilterParams& params, std::string* buffer);
 
     // ====================================
     static JoinRuntimeFilter* create_runtime_bloom_filter(ObjectPool* pool, LogicalType type);
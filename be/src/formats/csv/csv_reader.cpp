@@ -14,12 +14,67 @@
 
 #include "formats/csv/csv_reader.h"
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <unordered_set>
 
 namespace starrocks {
 
 using Field = Slice;
 
+// Returns the first character in [begin, end) which equals to any of |c0|, |c1|, |c2| and |c3|,
+// or |end| if there is no such character.
+static inline const char* find_first_of(const char* begin, const char* end, char c0, char c1, char c2, char c3) {
+    const char* p = begin;
+#ifdef __AVX2__
+    const __m256i v0 = _mm256_set1_epi8(c0);
+    const __m256i v1 = _mm256_set1_epi8(c1);
+    const __m256i v2 = _mm256_set1_epi8(c2);
+    const __m256i v3 = _mm256_set1_epi8(c3);
+    for (; p + 32 <= end; p += 32) {
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        __m256i eq = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chars, v0), _mm256_cmpeq_epi8(chars, v1)),
+                                     _mm256_or_si256(_mm256_cmpeq_epi8(chars, v2), _mm256_cmpeq_epi8(chars, v3)));
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i v0 = _mm_set1_epi8(c0);
+    const __m128i v1 = _mm_set1_epi8(c1);
+    const __m128i v2 = _mm_set1_epi8(c2);
+    const __m128i v3 = _mm_set1_epi8(c3);
+    for (; p + 16 <= end; p += 16) {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, v0), _mm_cmpeq_epi8(chars, v1)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(chars, v2), _mm_cmpeq_epi8(chars, v3)));
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(eq));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+    }
+#endif
+    for (; p < end; ++p) {
+        if (*p == c0 || *p == c1 || *p == c2 || *p == c3) {
+            return p;
+        }
+    }
+    return end;
+}
+
+// Skips the characters which can not change the parse state, returns whether any character is skipped.
+static inline bool skip_until_first_of(CSVBuffer& buff, char c0, char c1, char c2, char c3) {
+    const char* pos = buff.position();
+    const char* next = find_first_of(pos, buff.limit(), c0, c1, c2, c3);
+    buff.skip(next - pos);
+    return next != pos;
+}
+
 static std::pair<const char*, size_t> trim(const char* value, size_t len) {
     size_t begin = 0;
 
@@ -246,6 +301,11 @@ Status CSVReader::more_rows() {
         // 2. trimspace is enabled
         //    Remove the leading space before judging.
         case ENCLOSE:
+            // Only enclose and escape characters matter in an enclosed column.
+            if (skip_until_first_of(_buff, _parse_options.enclose, _parse_options.escape, _parse_options.enclose,
+                                    _parse_options.escape)) {
+                break;
+            }
             // enclose character again, There are two possibilities:
             // 1. ENCLOSE state is over
             // 2. enclose to escape
@@ -311,6 +371,14 @@ Status CSVReader::more_rows() {
                 preState = ORDINARY;
             }
 
+            // Skip the ordinary characters in batch, the state is not changed until a delimiter, escape or
+            // enclose character. Escaped characters falling through from ESCAPE are still handled one by one.
+            if (curState == ORDINARY &&
+                skip_until_first_of(_buff, _parse_options.row_delimiter[0], _parse_options.column_delimiter[0],
+                                    _parse_options.escape, _parse_options.enclose)) {
+                break;
+            }
+
             // newrow
             if (UNLIKELY(is_row_delimiter(notGetLine))) {
                 curState = NEWROW;
@@ -555,15 +623,42 @@ void CSVReader::split_record(const Record& record, Fields* columns) const {
     const size_t size = record.size;
 
     if (_column_delimiter_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _parse_options.column_delimiter[0]) {
-                if (_parse_options.trim_space) {
-                    std::pair<const char*, size_t> newPos = trim(value, ptr - value);
-                    columns->emplace_back(newPos.first, newPos.second);
-                } else {
-                    columns->emplace_back(value, ptr - value);
-                }
-                value = ptr + 1;
+        const char delimiter = _parse_options.column_delimiter[0];
+        const char* const end = record.data + size;
+        auto add_column = [&](const char* delimiter_pos) {
+            if (_parse_options.trim_space) {
+                std::pair<const char*, size_t> newPos = trim(value, delimiter_pos - value);
+                columns->emplace_back(newPos.first, newPos.second);
+            } else {
+                columns->emplace_back(value, delimiter_pos - value);
+            }
+            value = delimiter_pos + 1;
+        };
+        // Compare a block of characters at once, and walk through the bitmask of delimiters in it.
+#ifdef __AVX2__
+        const __m256i delimiters = _mm256_set1_epi8(delimiter);
+        for (; ptr + 32 <= end; ptr += 32) {
+            __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+            auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, delimiters)));
+            while (mask != 0) {
+                add_column(ptr + __builtin_ctz(mask));
+                mask &= mask - 1;
+            }
+        }
+#elif defined(__SSE2__)
+        const __m128i delimiters = _mm_set1_epi8(delimiter);
+        for (; ptr + 16 <= end; ptr += 16) {
+            __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+            auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, delimiters)));
+            while (mask != 0) {
+                add_column(ptr + __builtin_ctz(mask));
+                mask &= mask - 1;
+            }
+        }
+#endif
+        for (; ptr < end; ++ptr) {
+            if (*ptr == delimiter) {
+                add_column(ptr);
             }
         }
     } else {
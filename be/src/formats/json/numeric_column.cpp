@@ -34,24 +34,41 @@ static inline bool checked_cast(const FromType& from, ToType* to) {
     DIAGNOSTIC_POP
 }
 
+template <typename T, typename FromType>
+static inline Status append_checked_number(FixedLengthColumn<T>* column, const std::string& name, FromType in) {
+    T out{};
+    if (LIKELY(!checked_cast(in, &out))) {
+        column->append(out);
+        return Status::OK();
+    }
+    auto err_msg = strings::Substitute("Value is overflow. column=$0, value=$1", name, in);
+    return Status::InvalidArgument(err_msg);
+}
+
 // The value must be in type simdjson::ondemand::json_type::number;
 template <typename T>
 static Status add_column_with_numeric_value(FixedLengthColumn<T>* column, const TypeDescriptor& type_desc,
                                             const std::string& name, simdjson::ondemand::value* value) {
+    // get_number() parses the number once together with its type, while get_number_type() followed by
+    // get_int64() or get_double() parses it twice.
+    simdjson::ondemand::number number;
+    if (LIKELY(value->get_number().get(number) == simdjson::SUCCESS)) {
+        switch (number.get_number_type()) {
+        case simdjson::ondemand::number_type::signed_integer:
+            return append_checked_number(column, name, number.get_int64());
+        case simdjson::ondemand::number_type::unsigned_integer:
+            return append_checked_number(column, name, number.get_uint64());
+        case simdjson::ondemand::number_type::floating_point_number:
+            return append_checked_number(column, name, number.get_double());
+        }
+    }
+
+    // The value is not consumed if get_number() fails, try again with the typed getters.
     simdjson::ondemand::number_type tp = value->get_number_type();
 
     switch (tp) {
     case simdjson::ondemand::number_type::signed_integer: {
-        int64_t in = value->get_int64();
-        T out{};
-
-        if (!checked_cast(in, &out)) {
-            column->append_numbers(&out, sizeof(out));
-        } else {
-            auto err_msg = strings::Substitute("Value is overflow. column=$0, value=$1", name, in);
-            return Status::InvalidArgument(err_msg);
-        }
-        return Status::OK();
+        return append_checked_number(column, name, value->get_int64());
     }
 
     case simdjson::ondemand::number_type::unsigned_integer: {
@@ -79,7 +96,7 @@ static Status add_column_with_numeric_value(FixedLengthColumn<T>* column, const
         }
 
         if (!checked_cast_flag) {
-            column->append_numbers(&out, sizeof(out));
+            column->append(out);
         } else {
             auto err_msg = strings::Substitute("Value is overflow. column=$0, value=$1", name, in);
             return Status::InvalidArgument(err_msg);
@@ -88,16 +105,7 @@ static Status add_column_with_numeric_value(FixedLengthColumn<T>* column, const
     }
 
     case simdjson::ondemand::number_type::floating_point_number: {
-        double in = value->get_double();
-        T out{};
-
-        if (!checked_cast(in, &out)) {
-            column->append_numbers(&out, sizeof(out));
-        } else {
-            auto err_msg = strings::Substitute("Value is overflow. column=$0, value=$1", name, in);
-            return Status::InvalidArgument(err_msg);
-        }
-        return Status::OK();
+        return append_checked_number(column, name, value->get_double());
     }
     }
     return Status::OK();
@@ -119,14 +127,14 @@ static Status add_column_with_string_value(FixedLengthColumn<T>* column, const T
     }
 
     if (parse_result == StringParser::PARSE_SUCCESS) {
-        column->append_numbers(&v, sizeof(v));
+        column->append(v);
         return Status::OK();
     } else {
         // Attemp to parse the string as float.
         auto d = StringParser::string_to_float<double>(sv.data(), sv.length(), &parse_result);
         if (parse_result == StringParser::PARSE_SUCCESS) {
             if (!checked_cast(d, &v)) {
-                column->append_numbers(&v, sizeof(v));
+                column->append(v);
                 return Status::OK();
             } else {
                 auto err_msg = strings::Substitute("Value is overflow. column=$0, value=$1", name, d);
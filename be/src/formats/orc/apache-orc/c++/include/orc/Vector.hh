@@ -154,6 +154,9 @@ struct StringVectorBatch : public ColumnVectorBatch {
     // dict codes, iff. there is dictionary.
     DataBuffer<int64_t> codes;
     bool use_codes;
+    // values are stored back to back starting from data[0], and null values are empty strings
+    // at the position of the next value, so a range of values can be copied at once.
+    bool is_contiguous;
     void filter(uint8_t* f_data, uint32_t f_size, uint32_t true_size) override;
 };
 
@@ -838,6 +838,7 @@ void StringDictionaryColumnReader::next(ColumnVectorBatch& rowBatch, uint64_t nu
     rle->next(outputLengths, numValues, notNull);
     uint64_t dictionaryCount = dictionary->dictionaryOffset.size() - 1;
     byteBatch.use_codes = true;
+    byteBatch.is_contiguous = false;
     if (byteBatch.codes.capacity() < numValues) {
         byteBatch.codes.reserve(numValues);
     }
@@ -995,33 +996,42 @@ void StringDirectColumnReader::next(ColumnVectorBatch& rowBatch, uint64_t numVal
     // figure out the total length of data we need from the blob stream
     const size_t totalLength = computeSize(lengthPtr, notNull, numValues);
 
-    // Load data from the blob stream into our buffer until we have enough
-    // to get the rest directly out of the stream's buffer.
-    size_t bytesBuffered = 0;
-    byteBatch.blob.resize(totalLength);
-    char* ptr = byteBatch.blob.data();
     byteBatch.use_codes = false;
-    while (bytesBuffered + lastBufferLength < totalLength) {
-        memcpy(ptr + bytesBuffered, lastBuffer, lastBufferLength);
-        bytesBuffered += lastBufferLength;
-        const void* readBuffer;
-        int readLength;
-        if (!blobStream->Next(&readBuffer, &readLength)) {
-            throw ParseError("failed to read in StringDirectColumnReader.next");
+    byteBatch.is_contiguous = true;
+    char* ptr = nullptr;
+    if (totalLength <= lastBufferLength) {
+        // All values are in the stream's buffer, which stays valid until the next call
+        // of next/skip/seekToRowGroup, point to it directly instead of copying to blob.
+        ptr = const_cast<char*>(lastBuffer);
+        lastBuffer += totalLength;
+        lastBufferLength -= totalLength;
+    } else {
+        // Load data from the blob stream into our buffer until we have enough
+        // to get the rest directly out of the stream's buffer.
+        size_t bytesBuffered = 0;
+        byteBatch.blob.resize(totalLength);
+        ptr = byteBatch.blob.data();
+        while (bytesBuffered + lastBufferLength < totalLength) {
+            memcpy(ptr + bytesBuffered, lastBuffer, lastBufferLength);
+            bytesBuffered += lastBufferLength;
+            const void* readBuffer;
+            int readLength;
+            if (!blobStream->Next(&readBuffer, &readLength)) {
+                throw ParseError("failed to read in StringDirectColumnReader.next");
+            }
+            lastBuffer = static_cast<const char*>(readBuffer);
+            lastBufferLength = static_cast<size_t>(readLength);
         }
-        lastBuffer = static_cast<const char*>(readBuffer);
-        lastBufferLength = static_cast<size_t>(readLength);
-    }
 
-    if (bytesBuffered < totalLength) {
-        size_t moreBytes = totalLength - bytesBuffered;
-        memcpy(ptr + bytesBuffered, lastBuffer, moreBytes);
-        lastBuffer += moreBytes;
-        lastBufferLength -= moreBytes;
+        if (bytesBuffered < totalLength) {
+            size_t moreBytes = totalLength - bytesBuffered;
+            memcpy(ptr + bytesBuffered, lastBuffer, moreBytes);
+            lastBuffer += moreBytes;
+            lastBufferLength -= moreBytes;
+        }
     }
 
     size_t filledSlots = 0;
-    ptr = byteBatch.blob.data();
     if (notNull) {
         while (filledSlots < numValues) {
             startPtr[filledSlots] = const_cast<char*>(ptr);
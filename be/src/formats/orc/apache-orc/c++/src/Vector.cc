@@ -196,7 +196,8 @@ StringVectorBatch::StringVectorBatch(uint64_t _capacity, MemoryPool& pool)
           length(pool, _capacity),
           blob(pool),
           codes(pool, _capacity),
-          use_codes(false) {
+          use_codes(false),
+          is_contiguous(false) {
     // PASS
 }
 
@@ -234,6 +235,7 @@ void StringVectorBatch::filter(uint8_t* f_data, uint32_t f_size, uint32_t true_s
     if (use_codes) {
         DO_FILTER_FIELD(codes);
     }
+    is_contiguous = false;
 }
 
 void EncodedStringVectorBatch::filter(uint8_t* f_data, uint32_t f_size, uint32_t true_size) {
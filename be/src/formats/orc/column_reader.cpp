@@ -461,22 +461,42 @@ inline void Decimal32Or64Or128ColumnReader<DecimalType>::_fill_decimal_column_ge
     }
 }
 
-Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size) {
-    auto* data = down_cast<orc::StringVectorBatch*>(cvb);
+// Values of a direct encoded string column are stored back to back in the batch, copy them with
+// one memcpy and compute the offsets from the value pointers.
+static void fill_binary_column_from_contiguous_cvb(orc::StringVectorBatch* data, BinaryColumn* values, size_t from,
+                                                   size_t size) {
+    DCHECK(data->is_contiguous);
+    if (size == 0) {
+        return;
+    }
+    const char* const* starts = data->data.data() + from;
+    const int64_t* lengths = data->length.data() + from;
+    const char* begin = starts[0];
+    size_t num_bytes = starts[size - 1] + lengths[size - 1] - begin;
 
-    size_t len = 0;
-    for (size_t i = 0; i < size; ++i) {
-        len += data->length[from + i];
+    auto& vb = values->get_bytes();
+    size_t write_pos = vb.size();
+    // vb is using RawVectorPad16, resize will not initialize vector
+    vb.resize(write_pos + num_bytes);
+    if (num_bytes > 0) {
+        memcpy(vb.data() + write_pos, begin, num_bytes);
     }
-    size_t col_start = col->size();
 
-    if (_nullable) {
-        auto* c = ColumnHelper::as_raw_column<NullableColumn>(col);
-        c->null_column()->resize_uninitialized(col->size() + size);
-        handle_null(cvb, c, col_start, from, size, false);
+    auto& vo = values->get_offset();
+    size_t offset_pos = vo.size();
+    raw::stl_vector_resize_uninitialized(&vo, offset_pos + size);
+    uint32_t* offsets = vo.data() + offset_pos;
+    for (size_t i = 0; i < size; ++i) {
+        offsets[i] = write_pos + (starts[i] + lengths[i] - begin);
     }
+}
 
-    auto* values = ColumnHelper::cast_to_raw<TYPE_VARCHAR>(ColumnHelper::get_data_column(col.get()));
+void StringColumnReader::_fill_binary_column_from_cvb(orc::StringVectorBatch* data, BinaryColumn* values,
+                                                      size_t col_start, size_t from, size_t size) {
+    size_t len = 0;
+    for (size_t i = 0; i < size; ++i) {
+        len += data->length[from + i];
+    }
 
     auto& vb = values->get_bytes();
     // Need to resize after insert, because of padding char existed
@@ -487,11 +507,11 @@ Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col,
     raw::stl_vector_resize_uninitialized(&vo, vo.size() + size);
 
     size_t write_pos = vb.size();
-    if (cvb->hasNulls) {
+    if (data->hasNulls) {
         if (_type.type == TYPE_CHAR) {
             // Possibly there are some zero padding characters in value, we have to strip them off.
             for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
-                if (cvb->notNull[cvb_pos]) {
+                if (data->notNull[cvb_pos]) {
                     size_t str_size = remove_trailing_spaces(data->data[cvb_pos], data->length[cvb_pos]);
                     strings::memcpy_inlined(&vb[write_pos], data->data[cvb_pos], str_size);
                     write_pos += str_size;
@@ -504,7 +524,7 @@ Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col,
             }
         } else {
             for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
-                if (cvb->notNull[cvb_pos]) {
+                if (data->notNull[cvb_pos]) {
                     strings::memcpy_inlined(&vb[write_pos], data->data[cvb_pos], data->length[cvb_pos]);
                     write_pos += data->length[cvb_pos];
                     // Need plus 1 for offset
@@ -536,6 +556,26 @@ Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col,
     }
 
     vb.resize(write_pos);
+}
+
+Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size) {
+    auto* data = down_cast<orc::StringVectorBatch*>(cvb);
+    size_t col_start = col->size();
+
+    if (_nullable) {
+        auto* c = ColumnHelper::as_raw_column<NullableColumn>(col);
+        c->null_column()->resize_uninitialized(col->size() + size);
+        handle_null(cvb, c, col_start, from, size, false);
+    }
+
+    auto* values = ColumnHelper::cast_to_raw<TYPE_VARCHAR>(ColumnHelper::get_data_column(col.get()));
+
+    // CHAR values may have padding spaces to strip off, copy them one by one.
+    if (data->is_contiguous && _type.type != TYPE_CHAR) {
+        fill_binary_column_from_contiguous_cvb(data, values, from, size);
+    } else {
+        _fill_binary_column_from_cvb(data, values, col_start, from, size);
+    }
 
     // col_start == 0 and from == 0 means it's at top level of fill chunk, not in the middle of array
     // otherwise `broker_load_filter` does not work.
@@ -601,10 +641,6 @@ Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col,
 
 Status VarbinaryColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size) {
     auto* data = down_cast<orc::StringVectorBatch*>(cvb);
-    size_t len = 0;
-    for (size_t i = 0; i < size; ++i) {
-        len += data->length[from + i];
-    }
     size_t col_start = col->size();
 
     if (_nullable) {
@@ -614,6 +650,15 @@ Status VarbinaryColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& c
     }
 
     auto* values = ColumnHelper::cast_to_raw<TYPE_VARBINARY>(ColumnHelper::get_data_column(col.get()));
+    if (data->is_contiguous) {
+        fill_binary_column_from_contiguous_cvb(data, values, from, size);
+        return Status::OK();
+    }
+
+    size_t len = 0;
+    for (size_t i = 0; i < size; ++i) {
+        len += data->length[from + i];
+    }
     auto& vb = values->get_bytes();
     auto& vo = values->get_offset();
 
@@ -192,6 +192,10 @@ public:
     ~StringColumnReader() override = default;
 
     Status get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size) override;
+
+private:
+    void _fill_binary_column_from_cvb(orc::StringVectorBatch* data, BinaryColumn* values, size_t col_start,
+                                      size_t from, size_t size);
 };
 
 class VarbinaryColumnReader : public PrimitiveColumnReader {
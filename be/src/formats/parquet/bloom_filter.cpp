@@ -0,0 +1,171 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/parquet/bloom_filter.h"
+
+#include "column/datum.h"
+#include "formats/parquet/schema.h"
+#include "fs/fs.h"
+#include "runtime/types.h"
+#include "util/thrift_util.h"
+#include "util/xxh3.h"
+
+namespace starrocks::parquet {
+
+// BloomFilterHeader is 15 bytes in compact protocol, reserve some space for unknown fields.
+static constexpr uint32_t kBloomFilterHeaderReadSize = 64;
+
+Status ParquetBloomFilter::init(const char* bitset, uint32_t num_bytes) {
+    if (num_bytes < BYTES_PER_BLOCK || num_bytes > MAXIMUM_BYTES || num_bytes % BYTES_PER_BLOCK != 0) {
+        return Status::Corruption(strings::Substitute("invalid parquet bloom filter size: $0", num_bytes));
+    }
+    // reserve last byte for null flag, which is not part of the parquet bitset
+    _size = num_bytes + 1;
+    _num_bytes = num_bytes;
+    _data = new char[_size];
+    memcpy(_data, bitset, num_bytes);
+    _has_null = (bool*)(_data + _num_bytes);
+    *_has_null = false;
+    return Status::OK();
+}
+
+uint64_t ParquetBloomFilter::hash(const void* data, size_t size) {
+    return XXH64(data, size, 0);
+}
+
+bool ParquetBloomFilter::is_supported(const TypeDescriptor& type, const ParquetField& field) {
+    const tparquet::SchemaElement& element = field.schema_element;
+    switch (field.physical_type) {
+    case tparquet::Type::INT32:
+    case tparquet::Type::INT64: {
+        if (type.type != TYPE_TINYINT && type.type != TYPE_SMALLINT && type.type != TYPE_INT &&
+            type.type != TYPE_BIGINT) {
+            return false;
+        }
+        // unsigned, decimal and temporal annotations change the meaning of the stored bits
+        if (element.__isset.logicalType) {
+            return element.logicalType.__isset.INTEGER && element.logicalType.INTEGER.isSigned;
+        }
+        if (element.__isset.converted_type) {
+            auto converted_type = element.converted_type;
+            return converted_type == tparquet::ConvertedType::INT_8 ||
+                   converted_type == tparquet::ConvertedType::INT_16 ||
+                   converted_type == tparquet::ConvertedType::INT_32 ||
+                   converted_type == tparquet::ConvertedType::INT_64;
+        }
+        return true;
+    }
+    case tparquet::Type::BYTE_ARRAY: {
+        // CHAR values may be padded differently from the stored ones
+        if (type.type != TYPE_VARCHAR && type.type != TYPE_BINARY && type.type != TYPE_VARBINARY) {
+            return false;
+        }
+        if (element.__isset.logicalType && element.logicalType.__isset.DECIMAL) {
+            return false;
+        }
+        return !element.__isset.converted_type || element.converted_type != tparquet::ConvertedType::DECIMAL;
+    }
+    default:
+        return false;
+    }
+}
+
+bool ParquetBloomFilter::hash_datum(tparquet::Type::type physical_type, LogicalType type, const Datum& datum,
+                                    uint64_t* hash) {
+    if (datum.is_null()) {
+        return false;
+    }
+    int64_t int_value = 0;
+    switch (type) {
+    case TYPE_TINYINT:
+        int_value = datum.get_int8();
+        break;
+    case TYPE_SMALLINT:
+        int_value = datum.get_int16();
+        break;
+    case TYPE_INT:
+        int_value = datum.get_int32();
+        break;
+    case TYPE_BIGINT:
+        int_value = datum.get_int64();
+        break;
+    case TYPE_VARCHAR:
+    case TYPE_BINARY:
+    case TYPE_VARBINARY: {
+        if (physical_type != tparquet::Type::BYTE_ARRAY) {
+            return false;
+        }
+        const Slice& slice = datum.get_slice();
+        *hash = ParquetBloomFilter::hash(slice.data, slice.size);
+        return true;
+    }
+    default:
+        return false;
+    }
+
+    if (physical_type == tparquet::Type::INT32) {
+        if (int_value < std::numeric_limits<int32_t>::min() || int_value > std::numeric_limits<int32_t>::max()) {
+            return false;
+        }
+        auto value = static_cast<int32_t>(int_value);
+        *hash = ParquetBloomFilter::hash(&value, sizeof(value));
+        return true;
+    } else if (physical_type == tparquet::Type::INT64) {
+        *hash = ParquetBloomFilter::hash(&int_value, sizeof(int_value));
+        return true;
+    }
+    return false;
+}
+
+StatusOr<std::unique_ptr<ParquetBloomFilter>> ParquetBloomFilter::read(RandomAccessFile* file, size_t file_size,
+                                                                       const tparquet::ColumnMetaData& column_meta) {
+    DCHECK(column_meta.__isset.bloom_filter_offset);
+    int64_t offset = column_meta.bloom_filter_offset;
+    if (offset < 0 || offset >= static_cast<int64_t>(file_size)) {
+        return Status::Corruption(strings::Substitute("invalid parquet bloom filter offset: $0", offset));
+    }
+
+    uint32_t header_size = std::min<uint64_t>(kBloomFilterHeaderReadSize, file_size - offset);
+    std::vector<uint8_t> header_buf(header_size);
+    RETURN_IF_ERROR(file->read_at_fully(offset, header_buf.data(), header_size));
+    tparquet::BloomFilterHeader header;
+    RETURN_IF_ERROR(deserialize_thrift_msg(header_buf.data(), &header_size, TProtocolType::COMPACT, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+        return Status::NotSupported("unsupported parquet bloom filter algorithm, hash or compression");
+    }
+    if (header.numBytes <= 0 || offset + header_size + header.numBytes > static_cast<int64_t>(file_size)) {
+        return Status::Corruption(strings::Substitute("invalid parquet bloom filter size: $0", header.numBytes));
+    }
+
+    std::vector<char> bitset(header.numBytes);
+    RETURN_IF_ERROR(file->read_at_fully(offset + header_size, bitset.data(), header.numBytes));
+    auto bf = std::make_unique<ParquetBloomFilter>();
+    RETURN_IF_ERROR(bf->init(bitset.data(), header.numBytes));
+    return bf;
+}
+
+Status ParquetBloomFilter::serialize(std::string* buf) const {
+    tparquet::BloomFilterHeader header;
+    header.__set_numBytes(_num_bytes);
+    header.algorithm.__set_BLOCK(tparquet::SplitBlockAlgorithm());
+    header.hash.__set_XXHASH(tparquet::XxHash());
+    header.compression.__set_UNCOMPRESSED(tparquet::Uncompressed());
+
+    ThriftSerializer serializer(true, kBloomFilterHeaderReadSize);
+    RETURN_IF_ERROR(serializer.serialize(&header, buf));
+    buf->append(_data, _num_bytes);
+    return Status::OK();
+}
+
+} // namespace starrocks::parquet
@@ -0,0 +1,75 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "common/statusor.h"
+#include "gen_cpp/parquet_types.h"
+#include "storage/rowset/block_split_bloom_filter.h"
+#include "types/logical_type.h"
+
+namespace starrocks {
+class Datum;
+class RandomAccessFile;
+struct TypeDescriptor;
+} // namespace starrocks
+
+namespace starrocks::parquet {
+
+struct ParquetField;
+
+// Split block bloom filter defined by the parquet format spec.
+// It shares the block layout and the salts with BlockSplitBloomFilter, but the block of a hash is
+// picked by multiplying its high 32 bits with the block count, and values are hashed with
+// xxhash64 (seed 0) over their plain encoding.
+// The bitset written to the file does not include the trailing null flag byte of BloomFilter.
+class ParquetBloomFilter final : public BlockSplitBloomFilter {
+public:
+    // for write, |ndv| is the number of distinct values of the column chunk
+    Status init(uint64_t ndv, double fpp) { return BloomFilter::init(ndv, fpp, HASH_MURMUR3_X64_64); }
+
+    // for read, |bitset| is the data following BloomFilterHeader
+    Status init(const char* bitset, uint32_t num_bytes);
+
+    static uint64_t hash(const void* data, size_t size);
+
+    // Whether values of a slot with |type| stored in |field| can be tested against the bloom filter.
+    static bool is_supported(const TypeDescriptor& type, const ParquetField& field);
+
+    // Hash |datum| of |type| as the plain encoding of |physical_type|.
+    // Return false if the value can not be represented by |physical_type|.
+    static bool hash_datum(tparquet::Type::type physical_type, LogicalType type, const Datum& datum, uint64_t* hash);
+
+    // Read the bloom filter of a column chunk, |column_meta.bloom_filter_offset| must be set.
+    static StatusOr<std::unique_ptr<ParquetBloomFilter>> read(RandomAccessFile* file, size_t file_size,
+                                                              const tparquet::ColumnMetaData& column_meta);
+
+    // Serialize BloomFilterHeader followed by the bitset into |buf|.
+    Status serialize(std::string* buf) const;
+
+    void add_hash(uint64_t hash) override { _add_to_block(_block_index(hash), (uint32_t)hash); }
+
+    bool test_hash(uint64_t hash) const override { return _test_in_block(_block_index(hash), (uint32_t)hash); }
+
+private:
+    uint32_t _block_index(uint64_t hash) const {
+        uint64_t num_blocks = _num_bytes / BYTES_PER_BLOCK;
+        return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+    }
+};
+
+} // namespace starrocks::parquet
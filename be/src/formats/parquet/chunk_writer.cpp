@@ -19,6 +19,7 @@
 #include "column/array_column.h"
 #include "column/chunk.h"
 #include "column/column_helper.h"
+#include "column/column_viewer.h"
 #include "column/map_column.h"
 #include "column/struct_column.h"
 #include "column/vectorized_fwd.h"
@@ -54,6 +55,9 @@ Status ChunkWriter::write(Chunk* chunk) {
 
     for (size_t i = 0; i < _type_descs.size(); i++) {
         ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
+        if (_bloom_filter_fpp > 0 && support_bloom_filter(_type_descs[i])) {
+            _hash_values(_type_descs[i].type, col, chunk->num_rows(), &_value_hashes[i]);
+        }
         auto level_builder = LevelBuilder(_type_descs[i], _schema->field(i));
         level_builder.write(ctx, col, write_leaf_column);
     }
@@ -61,6 +65,100 @@ Status ChunkWriter::write(Chunk* chunk) {
     return Status::OK();
 }
 
+bool ChunkWriter::support_bloom_filter(const TypeDescriptor& type) {
+    switch (type.type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_CHAR:
+    case TYPE_VARCHAR:
+    case TYPE_BINARY:
+    case TYPE_VARBINARY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+template <LogicalType LT>
+static void hash_column_values(const ColumnPtr& col, size_t num_rows, phmap::flat_hash_set<uint64_t>* hashes) {
+    ColumnViewer<LT> viewer(col);
+    for (size_t i = 0; i < num_rows; i++) {
+        if (viewer.is_null(i)) {
+            continue;
+        }
+        // hash the value as its parquet plain encoding
+        if constexpr (isSliceLT<LT>) {
+            Slice value = viewer.value(i);
+            hashes->insert(ParquetBloomFilter::hash(value.data, value.size));
+        } else if constexpr (LT == TYPE_BIGINT) {
+            int64_t value = viewer.value(i);
+            hashes->insert(ParquetBloomFilter::hash(&value, sizeof(value)));
+        } else {
+            int32_t value = viewer.value(i);
+            hashes->insert(ParquetBloomFilter::hash(&value, sizeof(value)));
+        }
+    }
+}
+
+void ChunkWriter::_hash_values(LogicalType type, const ColumnPtr& col, size_t num_rows,
+                               phmap::flat_hash_set<uint64_t>* hashes) {
+    switch (type) {
+    case TYPE_TINYINT:
+        return hash_column_values<TYPE_TINYINT>(col, num_rows, hashes);
+    case TYPE_SMALLINT:
+        return hash_column_values<TYPE_SMALLINT>(col, num_rows, hashes);
+    case TYPE_INT:
+        return hash_column_values<TYPE_INT>(col, num_rows, hashes);
+    case TYPE_BIGINT:
+        return hash_column_values<TYPE_BIGINT>(col, num_rows, hashes);
+    default:
+        // CHAR/VARCHAR/BINARY/VARBINARY are all binary columns
+        return hash_column_values<TYPE_VARCHAR>(col, num_rows, hashes);
+    }
+}
+
+static int count_leaf_columns(const ::parquet::schema::NodePtr& node) {
+    if (node->is_primitive()) {
+        return 1;
+    }
+    auto* group = static_cast<const ::parquet::schema::GroupNode*>(node.get());
+    int num_leaves = 0;
+    for (int i = 0; i < group->field_count(); i++) {
+        num_leaves += count_leaf_columns(group->field(i));
+    }
+    return num_leaves;
+}
+
+void ChunkWriter::enable_bloom_filter(double fpp) {
+    DCHECK(fpp > 0 && fpp < 1);
+    _bloom_filter_fpp = fpp;
+    _value_hashes.resize(_type_descs.size());
+    _leaf_column_indexes.resize(_type_descs.size());
+    int leaf_column_idx = 0;
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        _leaf_column_indexes[i] = leaf_column_idx;
+        leaf_column_idx += count_leaf_columns(_schema->field(i));
+    }
+}
+
+StatusOr<RowGroupBloomFilters> ChunkWriter::build_bloom_filters() const {
+    RowGroupBloomFilters bloom_filters;
+    for (size_t i = 0; i < _value_hashes.size(); i++) {
+        if (_value_hashes[i].empty()) {
+            continue;
+        }
+        auto bf = std::make_unique<ParquetBloomFilter>();
+        RETURN_IF_ERROR(bf->init(_value_hashes[i].size(), _bloom_filter_fpp));
+        for (uint64_t hash : _value_hashes[i]) {
+            bf->add_hash(hash);
+        }
+        bloom_filters.emplace_back(_leaf_column_indexes[i], std::move(bf));
+    }
+    return bloom_filters;
+}
+
 void ChunkWriter::close() {
     _rg_writer->Close();
 }
@@ -31,12 +31,17 @@
 
 #include "column/chunk.h"
 #include "column/nullable_column.h"
+#include "formats/parquet/bloom_filter.h"
 #include "fs/fs.h"
 #include "runtime/runtime_state.h"
+#include "util/phmap/phmap.h"
 #include "util/priority_thread_pool.hpp"
 
 namespace starrocks::parquet {
 
+// Bloom filters of a row group, keyed by the leaf column index.
+using RowGroupBloomFilters = std::vector<std::pair<int, std::unique_ptr<ParquetBloomFilter>>>;
+
 // Wraps parquet::RowGroupWriter.
 // Write chunks into buffer. Flush on closing.
 class ChunkWriter {
@@ -51,12 +56,30 @@ public:
 
     int64_t estimated_buffered_bytes() const;
 
+    // Collect hashes of top level primitive columns to build bloom filters with |fpp|.
+    // Must be called before the first write.
+    void enable_bloom_filter(double fpp);
+
+    // Build bloom filters from the values written so far.
+    StatusOr<RowGroupBloomFilters> build_bloom_filters() const;
+
+    static bool support_bloom_filter(const TypeDescriptor& type);
+
 private:
+    static void _hash_values(LogicalType type, const ColumnPtr& col, size_t num_rows,
+                             phmap::flat_hash_set<uint64_t>* hashes);
+
     ::parquet::RowGroupWriter* _rg_writer;
     std::vector<TypeDescriptor> _type_descs;
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
     std::function<StatusOr<ColumnPtr>(Chunk*, size_t)> _eval_func;
     std::vector<int64_t> _estimated_buffered_bytes;
+
+    double _bloom_filter_fpp = 0;
+    // leaf column index of each top level column
+    std::vector<int> _leaf_column_indexes;
+    // distinct value hashes of each top level column, empty if bloom filter is not supported
+    std::vector<phmap::flat_hash_set<uint64_t>> _value_hashes;
 };
 
 } // namespace starrocks::parquet
@@ -15,10 +15,12 @@
 #include "formats/parquet/column_reader.h"
 
 #include <boost/algorithm/string.hpp>
+#include <optional>
 
 #include "column/array_column.h"
 #include "column/map_column.h"
 #include "column/struct_column.h"
+#include "common/config.h"
 #include "exec/exec_node.h"
 #include "exec/hdfs_scanner.h"
 #include "exprs/expr.h"
@@ -29,6 +31,7 @@
 #include "gutil/strings/substitute.h"
 #include "io/shared_buffered_input_stream.h"
 #include "simd/batch_run_counter.h"
+#include "simd/simd.h"
 #include "storage/column_or_predicate.h"
 #include "util/runtime_profile.h"
 #include "util/thrift_util.h"
@@ -98,6 +101,10 @@ public:
         DCHECK(_field->is_nullable ? dst->is_nullable() : true);
         ColumnContentType content_type =
                 _dict_filter_ctx == nullptr ? ColumnContentType::VALUE : ColumnContentType::DICT_CODE;
+        if (content_type == ColumnContentType::VALUE && filter != nullptr && _can_lazy_dict_decode() &&
+            SIMD::count_nonzero(*filter) < filter->size()) {
+            return _read_range_with_lazy_dict_decode(range, *filter, dst);
+        }
         if (!converter->need_convert) {
             SCOPED_RAW_TIMER(&_opts.stats->column_read_ns);
             return _reader->read_range(range, filter, content_type, dst);
@@ -229,6 +236,19 @@ private:
     // Returns true if all of the data pages in the column chunk are dict encoded
     bool _column_all_pages_dict_encoded();
 
+    // A dict encoded string column can be read as dict codes, and only the codes of rows
+    // selected by filter are decoded into values.
+    bool _can_lazy_dict_decode() {
+        if (!_lazy_dict_decode.has_value()) {
+            _lazy_dict_decode = config::parquet_lazy_dict_decode_enable && _col_type->is_string_type() &&
+                                !converter->need_convert && _field->max_rep_level() == 0 &&
+                                _column_all_pages_dict_encoded();
+        }
+        return _lazy_dict_decode.value();
+    }
+
+    Status _read_range_with_lazy_dict_decode(const Range<uint64_t>& range, const Filter& filter, Column* dst);
+
     const ColumnReaderOptions& _opts;
 
     std::unique_ptr<StoredColumnReader> _reader;
@@ -238,8 +258,52 @@ private:
     const TypeDescriptor* _col_type = nullptr;
     const tparquet::ColumnChunk* _chunk_metadata = nullptr;
     std::unique_ptr<ColumnOffsetIndexCtx> _offset_index_ctx;
+
+    std::optional<bool> _lazy_dict_decode;
+    // reused dict codes and their null flags for lazy dict decode
+    ColumnPtr _dict_codes;
+    NullData _dict_code_nulls;
 };
 
+Status ScalarColumnReader::_read_range_with_lazy_dict_decode(const Range<uint64_t>& range, const Filter& filter,
+                                                             Column* dst) {
+    if (_dict_codes == nullptr) {
+        _dict_codes = ColumnHelper::create_column(
+                TypeDescriptor::from_logical_type(ColumnDictFilterContext::kDictCodePrimitiveType), true);
+    }
+    _dict_codes->resize(0);
+    {
+        SCOPED_RAW_TIMER(&_opts.stats->column_read_ns);
+        RETURN_IF_ERROR(_reader->read_range(range, &filter, ColumnContentType::DICT_CODE, _dict_codes.get()));
+    }
+
+    SCOPED_RAW_TIMER(&_opts.stats->group_dict_decode_ns);
+    auto* codes_nullable_column = down_cast<NullableColumn*>(_dict_codes.get());
+    auto* codes_column = down_cast<FixedLengthColumn<int32_t>*>(codes_nullable_column->data_column().get());
+    size_t num_rows = codes_nullable_column->size();
+    DCHECK_EQ(num_rows, filter.size());
+
+    // rows not selected are decoded as empty values like nulls, they will be filtered out by the caller.
+    NullData& code_nulls = codes_nullable_column->null_column_data();
+    _dict_code_nulls.assign(code_nulls.begin(), code_nulls.end());
+    const uint8_t* selected = filter.data();
+    for (size_t i = 0; i < num_rows; i++) {
+        code_nulls[i] |= !selected[i];
+    }
+    codes_nullable_column->set_has_null(true);
+
+    size_t old_size = dst->size();
+    RETURN_IF_ERROR(get_dict_values(codes_column->get_data(), *codes_nullable_column, dst));
+    DCHECK_EQ(old_size + num_rows, dst->size());
+    if (dst->is_nullable()) {
+        auto* nullable_dst = down_cast<NullableColumn*>(dst);
+        NullData& dst_nulls = nullable_dst->null_column_data();
+        memcpy(dst_nulls.data() + old_size, _dict_code_nulls.data(), num_rows);
+        nullable_dst->update_has_null();
+    }
+    return Status::OK();
+}
+
 bool ScalarColumnReader::_column_all_pages_dict_encoded() {
     // The Parquet spec allows for column chunks to have mixed encodings
     // where some data pages are dictionary-encoded and others are plain
@@ -90,7 +90,6 @@ public:
     // initialize dictionary
     Status set_dict(int chunk_size, size_t num_values, Decoder* decoder) override {
         _dict.resize(num_values);
-        _indexes.resize(chunk_size);
         RETURN_IF_ERROR(decoder->next_batch(num_values, (uint8_t*)&_dict[0]));
         return Status::OK();
     }
@@ -107,9 +106,10 @@ public:
     }
 
     Status skip(size_t values_to_skip) override {
-        //TODO(Smith) still heavy work load
-        _indexes.reserve(values_to_skip);
-        _rle_batch_reader.GetBatch(&_indexes[0], values_to_skip);
+        auto ret = _rle_batch_reader.Skip(values_to_skip);
+        if (UNLIKELY(static_cast<size_t>(ret) != values_to_skip)) {
+            return Status::InternalError("DictDecoder skip failed");
+        }
         return Status::OK();
     }
 
@@ -140,7 +140,6 @@ private:
 
     RleBatchDecoder<uint32_t> _rle_batch_reader;
     std::vector<T> _dict;
-    std::vector<uint32_t> _indexes;
 };
 
 template <>
@@ -208,11 +207,12 @@ public:
             const uint8_t* null_data_ptr = null_data.data();
             for (size_t i = 0; i < size; i++) {
                 // if null, we assign dict code 0(there should be at least one value?)
+                // and an empty value, so no bytes are copied for null rows.
                 // null = 0, mask = 0xffffffff
                 // null = 1, mask = 0x00000000
                 uint32_t mask = ~(static_cast<uint32_t>(-null_data_ptr[i]));
                 int32_t code = mask & dict_codes[i];
-                slices[i] = _dict[code];
+                slices[i] = Slice(_dict[code].data, _dict[code].size & mask);
             }
         }
 
@@ -243,9 +243,10 @@ public:
     }
 
     Status skip(size_t values_to_skip) override {
-        //TODO(Smith) still heavy work load
-        _indexes.reserve(values_to_skip);
-        _rle_batch_reader.GetBatch(&_indexes[0], values_to_skip);
+        auto ret = _rle_batch_reader.Skip(values_to_skip);
+        if (UNLIKELY(static_cast<size_t>(ret) != values_to_skip)) {
+            return Status::InternalError("DictDecoder skip failed");
+        }
         return Status::OK();
     }
 
@@ -291,7 +292,6 @@ private:
     RleBatchDecoder<uint32_t> _rle_batch_reader;
     std::vector<uint8_t> _dict_data;
     std::vector<Slice> _dict;
-    std::vector<uint32_t> _indexes;
     std::vector<Slice> _slices;
 
     size_t _max_value_length = 0;
@@ -21,18 +21,23 @@
 #include "exec/exec_node.h"
 #include "exec/hdfs_scanner.h"
 #include "exprs/expr.h"
+#include "exprs/column_ref.h"
 #include "exprs/expr_context.h"
+#include "exprs/in_const_predicate.hpp"
 #include "exprs/runtime_filter_bank.h"
+#include "formats/parquet/bloom_filter.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/metadata.h"
 #include "formats/parquet/utils.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "storage/chunk_helper.h"
 #include "util/coding.h"
 #include "util/defer_op.h"
 #include "util/memcmp.h"
+#include "util/priority_thread_pool.hpp"
 #include "util/thrift_util.h"
 
 namespace starrocks::parquet {
@@ -288,6 +293,138 @@ StatusOr<bool> FileReader::_filter_group(const tparquet::RowGroup& row_group) {
         }
     }
 
+    // filter by bloom filter, it costs extra io so it comes last.
+    if (config::parquet_bloom_filter_enable) {
+        return _filter_group_with_bloom_filter(row_group);
+    }
+
+    return false;
+}
+
+template <LogicalType LT>
+static bool collect_in_const_values(Expr* expr, std::vector<Datum>* values) {
+    auto* pred = dynamic_cast<VectorizedInConstPredicate<LT>*>(expr);
+    // small integers may be kept in an array instead of the hash set.
+    // null in the set (from null safe equal joins) matches null values, which are not in the bloom filter.
+    if (pred == nullptr || pred->is_not_in() || pred->is_use_array() || pred->null_in_set()) {
+        return false;
+    }
+    for (const auto& value : pred->hash_set()) {
+        values->emplace_back(value);
+    }
+    return true;
+}
+
+// Collect the values that `slot = value` or `slot in (values)` can match.
+// Return false if |ctx| is not such a predicate on |slot|, null values are skipped.
+static StatusOr<bool> collect_eq_or_in_values(ExprContext* ctx, const SlotDescriptor& slot, std::vector<Datum>* values,
+                                              Columns* holders) {
+    Expr* root = ctx->root();
+    if (root->get_num_children() < 1 || !root->get_child(0)->is_slotref() ||
+        down_cast<ColumnRef*>(root->get_child(0))->slot_id() != slot.id()) {
+        return false;
+    }
+    if (root->node_type() == TExprNodeType::BINARY_PRED) {
+        if (root->op() != TExprOpcode::EQ) {
+            return false;
+        }
+    } else if (root->node_type() == TExprNodeType::IN_PRED) {
+        if (root->op() != TExprOpcode::FILTER_IN) {
+            return false;
+        }
+        // runtime in filter, values are only kept in the hash set
+        if (root->get_num_children() == 1) {
+            switch (slot.type().type) {
+            case TYPE_TINYINT:
+                return collect_in_const_values<TYPE_TINYINT>(root, values);
+            case TYPE_SMALLINT:
+                return collect_in_const_values<TYPE_SMALLINT>(root, values);
+            case TYPE_INT:
+                return collect_in_const_values<TYPE_INT>(root, values);
+            case TYPE_BIGINT:
+                return collect_in_const_values<TYPE_BIGINT>(root, values);
+            case TYPE_VARCHAR:
+                return collect_in_const_values<TYPE_VARCHAR>(root, values);
+            default:
+                return false;
+            }
+        }
+    } else {
+        return false;
+    }
+
+    for (int i = 1; i < root->get_num_children(); i++) {
+        Expr* child = root->get_child(i);
+        if (!child->is_constant() || child->type().type != slot.type().type) {
+            return false;
+        }
+        ASSIGN_OR_RETURN(ColumnPtr value, ctx->evaluate(child, nullptr));
+        if (value->size() != 1) {
+            return false;
+        }
+        Datum datum = value->get(0);
+        if (!datum.is_null()) {
+            values->emplace_back(datum);
+        }
+        holders->emplace_back(std::move(value));
+    }
+    return true;
+}
+
+StatusOr<bool> FileReader::_filter_group_with_bloom_filter(const tparquet::RowGroup& row_group) {
+    if (_scanner_ctx->conjunct_ctxs_by_slot.empty()) {
+        return false;
+    }
+    const TupleDescriptor& tuple_desc = *(_scanner_ctx->tuple_desc);
+
+    std::vector<Datum> values;
+    Columns holders;
+    for (SlotDescriptor* slot : tuple_desc.slots()) {
+        auto it = _scanner_ctx->conjunct_ctxs_by_slot.find(slot->id());
+        if (it == _scanner_ctx->conjunct_ctxs_by_slot.end()) continue;
+
+        const ParquetField* field = _meta_helper->get_parquet_field(slot->col_name());
+        if (field == nullptr || field->type.is_complex_type() ||
+            !ParquetBloomFilter::is_supported(slot->type(), *field)) {
+            continue;
+        }
+        if (static_cast<size_t>(field->physical_column_index) >= row_group.columns.size()) continue;
+        const auto& column_chunk = row_group.columns[field->physical_column_index];
+        if (!column_chunk.__isset.meta_data || !column_chunk.meta_data.__isset.bloom_filter_offset) continue;
+
+        // the bloom filter of this column is read lazily, only once for all the conjuncts.
+        std::unique_ptr<ParquetBloomFilter> bloom_filter;
+        for (ExprContext* ctx : it->second) {
+            values.clear();
+            holders.clear();
+            ASSIGN_OR_RETURN(bool collected, collect_eq_or_in_values(ctx, *slot, &values, &holders));
+            if (!collected) continue;
+
+            if (bloom_filter == nullptr) {
+                auto st = ParquetBloomFilter::read(_file, _file_size, column_chunk.meta_data);
+                if (!st.ok()) {
+                    // a broken or unknown bloom filter should never fail the query.
+                    LOG(WARNING) << "Failed to read parquet bloom filter of " << slot->col_name() << " in "
+                                 << _file->filename() << ": " << st.status();
+                    break;
+                }
+                bloom_filter = std::move(st.value());
+            }
+
+            bool maybe_exist = false;
+            for (const Datum& value : values) {
+                uint64_t hash = 0;
+                if (!ParquetBloomFilter::hash_datum(field->physical_type, slot->type().type, value, &hash) ||
+                    bloom_filter->test_hash(hash)) {
+                    maybe_exist = true;
+                    break;
+                }
+            }
+            if (!maybe_exist) {
+                return true;
+            }
+        }
+    }
     return false;
 }
 
@@ -570,28 +707,79 @@ Status FileReader::_init_group_readers() {
 
 Status FileReader::_prepare_cur_row_group() {
     auto& r = _row_group_readers[_cur_row_group_idx];
+    bool prefetched = _cur_row_group_idx == _prefetched_row_group_idx;
     // prepare row group
-    RETURN_IF_ERROR(r->prepare());
+    if (!prefetched) {
+        RETURN_IF_ERROR(r->prepare());
+    }
     // if coalesce read enabled, we have to
     // 0. clear last group memory
     // 1. allocate shared buffered input stream and
     // 2. collect io ranges of every row group reader.
     // 3. set io ranges to the stream.
     if (config::parquet_coalesce_read_enable && _sb_stream != nullptr) {
-        std::vector<io::SharedBufferedInputStream::IORange> ranges;
-        int64_t end_offset = 0;
-        r->collect_io_ranges(&ranges, &end_offset, ColumnIOType::PAGES);
-        int32_t counter = _scanner_ctx->lazy_column_coalesce_counter->load(std::memory_order_relaxed);
-        if (counter >= 0 || !config::io_coalesce_adaptive_lazy_active) {
+        bool coalesce_lazy_column = _coalesce_lazy_column();
+        if (coalesce_lazy_column) {
             _scanner_ctx->stats->group_active_lazy_coalesce_together += 1;
         } else {
             _scanner_ctx->stats->group_active_lazy_coalesce_seperately += 1;
         }
-        r->set_end_offset(end_offset);
-        RETURN_IF_ERROR(_sb_stream->set_io_ranges(ranges, counter >= 0));
+        if (!prefetched) {
+            RETURN_IF_ERROR(_set_io_ranges(_cur_row_group_idx, coalesce_lazy_column, nullptr));
+        } else if (coalesce_lazy_column != _prefetched_coalesce_lazy_column) {
+            // the coalesce mode has been changed by the reads of the previous row group after the prefetch
+            _sb_stream->release_range(r->start_offset(), r->end_offset());
+            RETURN_IF_ERROR(_set_io_ranges(_cur_row_group_idx, coalesce_lazy_column, nullptr));
+        }
         _group_reader_param.sb_stream = _sb_stream;
     }
+    return _prefetch_next_row_group();
+}
+
+Status FileReader::_prefetch_next_row_group() {
+    size_t next_idx = _cur_row_group_idx + 1;
+    if (!config::parquet_prefetch_next_row_group_enable || !config::parquet_coalesce_read_enable ||
+        _sb_stream == nullptr || next_idx >= _row_group_size) {
+        return Status::OK();
+    }
+    PriorityThreadPool* executor = ExecEnv::GetInstance()->scan_prefetch_pool();
+    if (executor == nullptr) {
+        return Status::OK();
+    }
 
+    auto& r = _row_group_readers[next_idx];
+    RETURN_IF_ERROR(r->prepare());
+    _prefetched_row_group_idx = next_idx;
+    _prefetched_coalesce_lazy_column = _coalesce_lazy_column();
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    RETURN_IF_ERROR(_set_io_ranges(next_idx, _prefetched_coalesce_lazy_column, &ranges));
+    if (!r->is_group_filtered()) {
+        _sb_stream->prefetch(executor, ranges);
+    }
+    return Status::OK();
+}
+
+bool FileReader::_coalesce_lazy_column() const {
+    int32_t counter = _scanner_ctx->lazy_column_coalesce_counter->load(std::memory_order_relaxed);
+    return counter >= 0 || !config::io_coalesce_adaptive_lazy_active;
+}
+
+Status FileReader::_set_io_ranges(size_t idx, bool coalesce_lazy_column,
+                                  std::vector<io::SharedBufferedInputStream::IORange>* io_ranges) {
+    auto& r = _row_group_readers[idx];
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    int64_t end_offset = 0;
+    r->collect_io_ranges(&ranges, &end_offset, ColumnIOType::PAGES);
+    int64_t start_offset = end_offset;
+    for (const auto& range : ranges) {
+        start_offset = std::min(start_offset, range.offset);
+    }
+    r->set_start_offset(start_offset);
+    r->set_end_offset(end_offset);
+    RETURN_IF_ERROR(_sb_stream->set_io_ranges(ranges, coalesce_lazy_column));
+    if (io_ranges != nullptr) {
+        *io_ranges = std::move(ranges);
+    }
     return Status::OK();
 }
 
@@ -78,6 +78,9 @@ private:
     // filter row group by min/max conjuncts
     StatusOr<bool> _filter_group(const tparquet::RowGroup& row_group);
 
+    // filter row group by testing values of equal/in conjuncts against column bloom filters
+    StatusOr<bool> _filter_group_with_bloom_filter(const tparquet::RowGroup& row_group);
+
     // get row group to read
     // if scan range conatain the first byte in the row group, will be read
     // TODO: later modify the larger block should be read
@@ -102,6 +105,16 @@ private:
 
     Status _prepare_cur_row_group();
 
+    // prepare the next row group and read the io ranges of its active columns in background
+    Status _prefetch_next_row_group();
+
+    // whether the io ranges of lazy columns are coalesced with the active ones, adapted by the lazy column reads
+    bool _coalesce_lazy_column() const;
+
+    // register the io ranges of the row group to the shared buffered stream, and return them if |io_ranges| is set
+    Status _set_io_ranges(size_t idx, bool coalesce_lazy_column,
+                          std::vector<io::SharedBufferedInputStream::IORange>* io_ranges);
+
     // decode min/max value from row group stats
     Status _decode_min_max_column(const ParquetField& field, const std::string& timezone, const TypeDescriptor& type,
                                   const tparquet::ColumnMetaData& column_meta,
@@ -120,6 +133,10 @@ private:
     std::vector<std::shared_ptr<GroupReader>> _row_group_readers;
     size_t _cur_row_group_idx = 0;
     size_t _row_group_size = 0;
+    // index of the row group prepared by _prefetch_next_row_group()
+    size_t _prefetched_row_group_idx = SIZE_MAX;
+    // coalesce mode of the io ranges registered by the prefetch
+    bool _prefetched_coalesce_lazy_column = true;
 
     size_t _total_row_count = 0;
     size_t _scan_row_count = 0;
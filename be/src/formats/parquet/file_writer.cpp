@@ -27,14 +27,18 @@
 #include "column/map_column.h"
 #include "column/struct_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "exprs/column_ref.h"
 #include "exprs/expr.h"
+#include "gen_cpp/parquet_types.h"
 #include "runtime/exec_env.h"
+#include "util/coding.h"
 #include "util/defer_op.h"
 #include "util/priority_thread_pool.hpp"
 #include "util/runtime_profile.h"
 #include "util/slice.h"
+#include "util/thrift_util.h"
 
 namespace starrocks::parquet {
 
@@ -64,6 +68,12 @@ arrow::Status ParquetOutputStream::Write(const void* data, int64_t nbytes) {
 
     const char* ch = reinterpret_cast<const char*>(data);
 
+    if (_buffering) {
+        DCHECK(_header_state == WRITEN);
+        _buffer.append(ch, nbytes);
+        return arrow::Status::OK();
+    }
+
     if (_header_state == INITED) {
         _header_state = CACHED;
     } else {
@@ -87,10 +97,18 @@ arrow::Result<int64_t> ParquetOutputStream::Tell() const {
     if (_header_state == CACHED) {
         return 4;
     } else {
-        return _wfile->size();
+        return _wfile->size() + _buffer.size();
     }
 }
 
+std::string ParquetOutputStream::take_buffered() {
+    std::string buffered = std::move(_buffer);
+    // a moved-from string is only valid but unspecified
+    _buffer.clear();
+    _buffering = false;
+    return buffered;
+}
+
 arrow::Status ParquetOutputStream::Close() {
     if (_is_closed) {
         return arrow::Status::OK();
@@ -347,6 +365,13 @@ Status FileWriterBase::init() {
     if (_writer == nullptr) {
         return Status::InternalError("Failed to create file writer");
     }
+    if (config::parquet_writer_bloom_filter_enable) {
+        _bloom_filter_fpp = config::parquet_writer_bloom_filter_fpp;
+        if (_bloom_filter_fpp <= 0 || _bloom_filter_fpp >= 1) {
+            return Status::InvalidArgument(
+                    fmt::format("invalid parquet_writer_bloom_filter_fpp: {}", _bloom_filter_fpp));
+        }
+    }
     return Status::OK();
 }
 
@@ -355,9 +380,78 @@ void FileWriterBase::_generate_chunk_writer() {
     if (_chunk_writer == nullptr) {
         auto rg_writer = _writer->AppendBufferedRowGroup();
         _chunk_writer = std::make_unique<ChunkWriter>(rg_writer, _type_descs, _schema, _eval_func);
+        if (_bloom_filter_fpp > 0) {
+            _chunk_writer->enable_bloom_filter(_bloom_filter_fpp);
+        }
     }
 }
 
+Status FileWriterBase::_collect_bloom_filters() {
+    if (_bloom_filter_fpp <= 0 || _chunk_writer == nullptr) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(auto bloom_filters, _chunk_writer->build_bloom_filters());
+    _row_group_bloom_filters.emplace_back(std::move(bloom_filters));
+    return Status::OK();
+}
+
+bool FileWriterBase::_has_bloom_filters() const {
+    for (const auto& bloom_filters : _row_group_bloom_filters) {
+        if (!bloom_filters.empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Status FileWriterBase::_write_bloom_filters_and_footer() {
+    // footer: file metadata | metadata length (4 bytes) | "PAR1"
+    std::string footer = _outstream->take_buffered();
+    if (footer.size() < 8 || memcmp(footer.data() + footer.size() - 4, "PAR1", 4) != 0) {
+        return Status::InternalError("Invalid parquet footer written by arrow");
+    }
+    uint32_t metadata_len = decode_fixed32_le(reinterpret_cast<const uint8_t*>(footer.data()) + footer.size() - 8);
+    if (metadata_len + 8 != footer.size()) {
+        return Status::InternalError("Invalid parquet footer length written by arrow");
+    }
+    tparquet::FileMetaData t_metadata;
+    RETURN_IF_ERROR(deserialize_thrift_msg(reinterpret_cast<const uint8_t*>(footer.data()), &metadata_len,
+                                           TProtocolType::COMPACT, &t_metadata));
+    if (t_metadata.row_groups.size() != _row_group_bloom_filters.size()) {
+        return Status::InternalError(fmt::format("Mismatched row groups {} and bloom filters {}",
+                                                 t_metadata.row_groups.size(), _row_group_bloom_filters.size()));
+    }
+
+    auto write = [&](const std::string& data) {
+        auto st = _outstream->Write(data.data(), data.size());
+        return st.ok() ? Status::OK() : Status::IOError(st.message());
+    };
+
+    std::string buf;
+    for (size_t i = 0; i < _row_group_bloom_filters.size(); i++) {
+        auto& columns = t_metadata.row_groups[i].columns;
+        for (const auto& [leaf_column_idx, bloom_filter] : _row_group_bloom_filters[i]) {
+            DCHECK_LT(leaf_column_idx, columns.size());
+            auto offset = _outstream->Tell();
+            if (!offset.ok()) {
+                return Status::IOError(offset.status().message());
+            }
+            buf.clear();
+            RETURN_IF_ERROR(bloom_filter->serialize(&buf));
+            RETURN_IF_ERROR(write(buf));
+            columns[leaf_column_idx].meta_data.__set_bloom_filter_offset(*offset);
+        }
+    }
+    _row_group_bloom_filters.clear();
+
+    ThriftSerializer serializer(true, footer.size());
+    buf.clear();
+    RETURN_IF_ERROR(serializer.serialize(&t_metadata, &buf));
+    put_fixed32_le(&buf, buf.size());
+    buf.append("PAR1");
+    return write(buf);
+}
+
 Status FileWriterBase::write(Chunk* chunk) {
     if (!chunk->has_rows()) {
         return Status::OK();
@@ -403,6 +497,7 @@ Status FileWriterBase::split_offsets(std::vector<int64_t>& splitOffsets) const {
 
 Status SyncFileWriter::_flush_row_group() {
     if (_chunk_writer != nullptr) {
+        RETURN_IF_ERROR(_collect_bloom_filters());
         try {
             _chunk_writer->close();
         } catch (const ::parquet::ParquetStatusException& e) {
@@ -424,12 +519,19 @@ Status SyncFileWriter::close() {
     }
 
     RETURN_IF_ERROR(_flush_row_group());
+    bool has_bloom_filters = _has_bloom_filters();
+    if (has_bloom_filters) {
+        _outstream->start_buffering();
+    }
     try {
         _writer->Close();
     } catch (const ::parquet::ParquetStatusException& e) {
         LOG(WARNING) << "close writer error: " << e.what();
         return Status::IOError(fmt::format("{}: {}", "close writer error", e.what()));
     }
+    if (has_bloom_filters) {
+        RETURN_IF_ERROR(_write_bloom_filters_and_footer());
+    }
 
     auto arrow_st = _outstream->Close();
     if (!arrow_st.ok()) {
@@ -468,6 +570,11 @@ Status AsyncFileWriter::_flush_row_group() {
         SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_state->instance_mem_tracker());
         SCOPED_TIMER(_io_timer);
         if (_chunk_writer != nullptr) {
+            auto st = _collect_bloom_filters();
+            if (!st.ok()) {
+                LOG(WARNING) << "build bloom filter error: " << st;
+                set_io_status(st);
+            }
             try {
                 _chunk_writer->close();
             } catch (const ::parquet::ParquetStatusException& e) {
@@ -511,12 +618,23 @@ Status AsyncFileWriter::close(RuntimeState* state,
             // set closed to true anyway
             _closed.store(true);
         });
+        bool has_bloom_filters = _has_bloom_filters();
+        if (has_bloom_filters) {
+            _outstream->start_buffering();
+        }
         try {
             _writer->Close();
         } catch (const ::parquet::ParquetStatusException& e) {
             LOG(WARNING) << "close writer error: " << e.what();
             set_io_status(Status::IOError(fmt::format("{}: {}", "close writer error", e.what())));
         }
+        if (has_bloom_filters) {
+            auto st = _write_bloom_filters_and_footer();
+            if (!st.ok()) {
+                LOG(WARNING) << "write bloom filter error: " << st;
+                set_io_status(st);
+            }
+        }
         _chunk_writer = nullptr;
         _file_metadata = _writer->metadata();
         auto st = _outstream->Close();
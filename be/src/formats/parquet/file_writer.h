@@ -59,9 +59,18 @@ public:
 
     bool closed() const override { return _is_closed; };
 
+    // Keep the following writes in memory instead of appending them to the file,
+    // used to take the footer written by arrow and write it again after the bloom filters.
+    void start_buffering() { _buffering = true; }
+
+    // Stop buffering and return the buffered bytes.
+    std::string take_buffered();
+
 private:
     std::unique_ptr<starrocks::WritableFile> _wfile;
     bool _is_closed = false;
+    bool _buffering = false;
+    std::string _buffer;
 
     enum HEADER_STATE {
         INITED = 1,
@@ -129,6 +138,15 @@ protected:
 
     virtual Status _flush_row_group() = 0;
 
+    // Take the bloom filters of the current row group before it is closed.
+    Status _collect_bloom_filters();
+
+    bool _has_bloom_filters() const;
+
+    // Write bloom filters in front of the footer buffered by `_outstream`, then write the
+    // footer again with their offsets.
+    Status _write_bloom_filters_and_footer();
+
 private:
     bool is_last_row_group() {
         return _max_file_size - _writer->num_row_groups() * _max_row_group_size < 2 * _max_row_group_size;
@@ -148,6 +166,10 @@ protected:
     const static int64_t kDefaultMaxRowGroupSize = 128 * 1024 * 1024; // 128MB
     int64_t _max_row_group_size = kDefaultMaxRowGroupSize;
     int64_t _max_file_size = 512 * 1024 * 1024; // 512MB
+
+    // zero means bloom filters are not written
+    double _bloom_filter_fpp = 0;
+    std::vector<RowGroupBloomFilters> _row_group_bloom_filters;
 };
 
 class SyncFileWriter : public FileWriterBase {
@@ -101,7 +101,11 @@ public:
     void close();
     void collect_io_ranges(std::vector<io::SharedBufferedInputStream::IORange>* ranges, int64_t* end_offset,
                            ColumnIOType type = ColumnIOType::PAGES);
+    void set_start_offset(int64_t value) { _start_offset = value; }
+    int64_t start_offset() const { return _start_offset; }
     void set_end_offset(int64_t value) { _end_offset = value; }
+    int64_t end_offset() const { return _end_offset; }
+    bool is_group_filtered() const { return _is_group_filtered; }
 
     void _use_as_dict_filter_column(int col_idx, SlotId slot_id, std::vector<std::string>& sub_field_path);
     Status _rewrite_conjunct_ctxs_to_predicates(bool* is_group_filtered);
@@ -157,6 +161,7 @@ public:
 
     ColumnReaderOptions _column_reader_opts;
 
+    int64_t _start_offset = 0;
     int64_t _end_offset = 0;
 
     // columns(index) use as dict filter column
@@ -43,10 +43,10 @@ public:
 
     size_t next_repeated_count() {
         DCHECK_EQ(_encoding, tparquet::Encoding::RLE);
-        return _rle_decoder.repeated_count();
+        return _rle_decoder.NextNumRepeats();
     }
 
-    level_t get_repeated_value(size_t count) { return _rle_decoder.get_repeated_value(count); }
+    level_t get_repeated_value(size_t count) { return _rle_decoder.GetRepeatedValue(count); }
 
     void get_levels(level_t** levels, size_t* num_levels) {
         *levels = &_levels[0];
@@ -121,7 +121,7 @@ private:
     level_t _bit_width = 0;
     [[maybe_unused]] level_t _max_level = 0;
     uint32_t _num_levels = 0;
-    RleDecoder<level_t> _rle_decoder;
+    RleBatchDecoder<level_t> _rle_decoder;
     BitReader _bit_packed_decoder;
 
     int64_t* const _timer;
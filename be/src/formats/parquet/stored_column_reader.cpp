@@ -267,11 +267,8 @@ Status StoredColumnReader::create(const ColumnReaderOptions& opts, const Parquet
 
 size_t StoredColumnReaderImpl::count_not_null(level_t* def_levels, size_t num_parsed_levels, level_t max_def_level) {
     size_t count = 0;
-    for (int i = 0; i < num_parsed_levels; ++i) {
-        level_t def_level = def_levels[i];
-        if (def_level == max_def_level) {
-            count++;
-        }
+    for (size_t i = 0; i < num_parsed_levels; ++i) {
+        count += (def_levels[i] == max_def_level);
     }
     return count;
 }
@@ -424,9 +421,11 @@ Status OptionalStoredColumnReader::_read_values_on_levels(size_t num_values,
         RETURN_IF_ERROR(_decode_levels(&num_values, &level_parsed, &def_levels));
         DCHECK_EQ(num_values, level_parsed);
         _is_nulls.resize(num_values);
-        // decode def levels
+        // decode def levels, keep max def level in a local so that the loop can be vectorized
+        const level_t max_def_level = _field->max_def_level();
+        uint16_t* __restrict__ is_nulls = _is_nulls.data();
         for (size_t i = 0; i < num_values; ++i) {
-            _is_nulls[i] = def_levels[i] < _field->max_def_level();
+            is_nulls[i] = def_levels[i] < max_def_level;
         }
         return _reader->decode_values(num_values, &_is_nulls[0], content_type, dst);
     }
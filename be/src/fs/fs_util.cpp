@@ -14,12 +14,20 @@
 
 #include "fs/fs_util.h"
 
+#include <fcntl.h>
 #include <fmt/format.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/fs.h>
+#endif
 
+#include <cstring>
 #include <iomanip>
 #include <set>
 #include <sstream>
 
+#include "gutil/macros.h"
 #include "util/md5.h"
 
 namespace starrocks::fs {
@@ -68,4 +76,35 @@ StatusOr<std::string> md5sum(const std::string& path) {
     return ss.str();
 }
 
+Status clone_file(const std::string& src_path, const std::string& dst_path) {
+#ifdef FICLONE
+    int src_fd;
+    RETRY_ON_EINTR(src_fd, open(src_path.c_str(), O_RDONLY));
+    if (src_fd < 0) {
+        return Status::IOError(fmt::format("{}: {}", src_path, std::strerror(errno)));
+    }
+    int dst_fd;
+    RETRY_ON_EINTR(dst_fd, open(dst_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666));
+    if (dst_fd < 0) {
+        int err = errno;
+        ::close(src_fd);
+        return Status::IOError(fmt::format("{}: {}", dst_path, std::strerror(err)));
+    }
+    int ret = ioctl(dst_fd, FICLONE, src_fd);
+    int err = errno;
+    ::close(src_fd);
+    ::close(dst_fd);
+    if (ret == 0) {
+        return Status::OK();
+    }
+    ::unlink(dst_path.c_str());
+    if (err == EOPNOTSUPP || err == EXDEV || err == EINVAL || err == ENOTTY) {
+        return Status::NotSupported(fmt::format("clone {} to {}: {}", src_path, dst_path, std::strerror(err)));
+    }
+    return Status::IOError(fmt::format("clone {} to {}: {}", src_path, dst_path, std::strerror(err)));
+#else
+    return Status::NotSupported(fmt::format("clone {} to {}: not supported on this platform", src_path, dst_path));
+#endif
+}
+
 } // namespace starrocks::fs
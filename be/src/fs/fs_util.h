@@ -31,6 +31,10 @@ Status list_dirs_files(const std::string& path, std::set<std::string>* dirs, std
 Status list_dirs_files(FileSystem* fs, const std::string& path, std::set<std::string>* dirs,
                        std::set<std::string>* files);
 
+// Create dst as a copy-on-write clone of the local file src, the data blocks are shared instead of copied.
+// Return NotSupported if the file system cannot clone files, e.g. ext4.
+Status clone_file(const std::string& src_path, const std::string& dst_path);
+
 inline StatusOr<std::unique_ptr<SequentialFile>> new_sequential_file(const std::string& path) {
     ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(path));
     return fs->new_sequential_file(path);
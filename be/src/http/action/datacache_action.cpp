@@ -140,6 +140,19 @@ void DataCacheAction::_handle_stat(HttpRequest* req, BlockCache* cache) {
                         : std::round(double(metrics.detail_l1->hit_count) / double(total_reads) * 100.0) / 100.0;
         root.AddMember("hit_rate", rapidjson::Value(hit_rate), allocator);
 
+        auto admission = cache->admission_metrics();
+        root.AddMember("admission_enabled", rapidjson::Value(admission.enabled), allocator);
+        root.AddMember("admission_admit_count", rapidjson::Value(admission.admit_count), allocator);
+        root.AddMember("admission_reject_count", rapidjson::Value(admission.reject_count), allocator);
+
+        auto warmup = cache->warmup_metrics();
+        root.AddMember("warmup_enabled", rapidjson::Value(warmup.enabled), allocator);
+        root.AddMember("warmup_running", rapidjson::Value(warmup.running), allocator);
+        root.AddMember("warmup_total_blocks", rapidjson::Value(warmup.total_blocks), allocator);
+        root.AddMember("warmup_finished_blocks", rapidjson::Value(warmup.finished_blocks), allocator);
+        root.AddMember("warmup_warmed_blocks", rapidjson::Value(warmup.warmed_blocks), allocator);
+        root.AddMember("warmup_warmed_bytes", rapidjson::Value(warmup.warmed_bytes), allocator);
+
         root.AddMember("hit_bytes", rapidjson::Value(metrics.detail_l1->hit_bytes), allocator);
         root.AddMember("miss_bytes", rapidjson::Value(metrics.detail_l1->miss_bytes), allocator);
 
@@ -96,9 +96,13 @@ Status CacheInputStream::_read_block(int64_t offset, int64_t size, char* out, bo
         if (ret.ok()) {
             sb = ret.value();
             if (sb->buffer.capacity() > 0) {
-                strings::memcpy_inlined(out, sb->buffer.data() + offset - sb->offset, size);
+                // The buffer may be reserved by a prefetch which is still reading into it,
+                // get_bytes() waits for the prefetch before returning the data.
+                const uint8_t* buffer = nullptr;
+                RETURN_IF_ERROR(_sb_stream->get_bytes(&buffer, sb->offset, sb->size));
+                strings::memcpy_inlined(out, buffer + offset - sb->offset, size);
                 if (_enable_populate_cache) {
-                    _populate_cache_from_zero_copy_buffer((const char*)sb->buffer.data() + block_offset - sb->offset,
+                    _populate_cache_from_zero_copy_buffer((const char*)buffer + block_offset - sb->offset,
                                                           block_offset, load_size);
                 }
                 return Status::OK();
@@ -169,8 +173,12 @@ Status CacheInputStream::_read_block(int64_t offset, int64_t size, char* out, bo
     if (_enable_populate_cache && res.is_not_found()) {
         SCOPED_RAW_TIMER(&_stats.write_cache_ns);
         WriteCacheOptions options;
+        options.priority = _priority;
         Status r = _cache->write_buffer(_cache_key, block_offset, load_size, src, &options);
-        if (r.ok()) {
+        if (r.ok() && options.stats.skipped) {
+            _stats.skip_write_cache_count += 1;
+            _stats.skip_write_cache_bytes += load_size;
+        } else if (r.ok()) {
             _stats.write_cache_count += 1;
             _stats.write_cache_bytes += load_size;
             _stats.write_mem_cache_bytes += options.stats.write_mem_bytes;
@@ -286,8 +294,12 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
         SCOPED_RAW_TIMER(&_stats.write_cache_ns);
         WriteCacheOptions options;
         options.overwrite = false;
+        options.priority = _priority;
         Status r = cache->write_buffer(_cache_key, offset, size, buf, &options);
-        if (r.ok()) {
+        if (r.ok() && options.stats.skipped) {
+            _stats.skip_write_cache_count += 1;
+            _stats.skip_write_cache_bytes += size;
+        } else if (r.ok()) {
             _stats.write_cache_count += 1;
             _stats.write_cache_bytes += size;
             _stats.write_mem_cache_bytes += options.stats.write_mem_bytes;
@@ -67,6 +67,8 @@ public:
 
     void set_enable_block_buffer(bool v) { _enable_block_buffer = v; }
 
+    void set_priority(int32_t v) { _priority = v; }
+
     int64_t get_align_size() const;
 
     StatusOr<std::string_view> peek(int64_t count) override;
@@ -95,6 +97,7 @@ private:
     int64_t _size;
     bool _enable_populate_cache = false;
     bool _enable_block_buffer = false;
+    int32_t _priority = 0;
     BlockCache* _cache = nullptr;
     int64_t _block_size = 0;
     std::unordered_map<int64_t, BlockBuffer> _block_map;
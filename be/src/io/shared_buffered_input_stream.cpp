@@ -19,6 +19,7 @@
 #include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
+#include "util/priority_thread_pool.hpp"
 #include "util/runtime_profile.h"
 
 namespace starrocks::io {
@@ -27,6 +28,10 @@ SharedBufferedInputStream::SharedBufferedInputStream(std::shared_ptr<SeekableInp
                                                      size_t file_size)
         : _stream(std::move(stream)), _filename(std::move(filename)), _file_size(file_size) {}
 
+SharedBufferedInputStream::~SharedBufferedInputStream() {
+    _wait_prefetch(_map.begin(), _map.end());
+}
+
 void SharedBufferedInputStream::SharedBuffer::align(int64_t align_size, int64_t file_size) {
     if (align_size != 0) {
         offset = raw_offset / align_size * align_size;
@@ -77,18 +82,33 @@ void SharedBufferedInputStream::_merge_small_ranges(const std::vector<IORange>&
             _map.insert(std::make_pair(sb.raw_offset + sb.raw_size, sb));
         };
 
+        // requested and skipped bytes of [unmerge, i-1]
+        int64_t requested_size = small_ranges[0].size;
+        int64_t skipped_size = 0;
+        auto can_skip = [&](int64_t dist, int64_t size) {
+            if (dist <= _options.small_dist_size || _options.max_skip_ratio <= 0) {
+                return true;
+            }
+            return skipped_size + dist <= _options.max_skip_ratio * (requested_size + size);
+        };
+
         size_t unmerge = 0;
         for (size_t i = 1; i < small_ranges.size(); i++) {
             const auto& prev = small_ranges[i - 1];
             const auto& now = small_ranges[i];
             size_t now_end = now.offset + now.size;
             size_t prev_end = prev.offset + prev.size;
+            int64_t dist = now.offset - prev_end;
             if (((now_end - small_ranges[unmerge].offset) <= _options.max_buffer_size) &&
-                (now.offset - prev_end) <= _options.max_dist_size) {
+                dist <= _options.max_dist_size && can_skip(dist, now.size)) {
+                requested_size += now.size;
+                skipped_size += dist;
                 continue;
             } else {
                 update_map(unmerge, i - 1);
                 unmerge = i;
+                requested_size = now.size;
+                skipped_size = 0;
             }
         }
         update_map(unmerge, small_ranges.size() - 1);
@@ -208,9 +228,15 @@ StatusOr<SharedBufferedInputStream::SharedBuffer*> SharedBufferedInputStream::fi
 Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offset, size_t nbytes) {
     ASSIGN_OR_RETURN(auto ret, find_shared_buffer(offset, nbytes));
     SharedBuffer& sb = *ret;
-    if (sb.buffer.capacity() == 0) {
-        RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
-        SCOPED_RAW_TIMER(&_shared_io_timer);
+    if (sb.buffer.capacity() == 0 || sb.prefetch != nullptr) {
+        bool loaded = false;
+        if (sb.prefetch != nullptr) {
+            // buffer has been reserved by prefetch()
+            loaded = _wait_prefetch(sb);
+        } else {
+            RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
+            sb.buffer.reserve(sb.size);
+        }
         _shared_io_count += 1;
         _shared_io_bytes += sb.size;
         if (sb.size > sb.raw_size) {
@@ -218,22 +244,121 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
             // we don't count this
             _shared_align_io_bytes += sb.size - sb.raw_size;
         }
-        sb.buffer.reserve(sb.size);
-        RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+        if (!loaded) {
+            SCOPED_RAW_TIMER(&_shared_io_timer);
+            RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+        }
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
 }
 
+void SharedBufferedInputStream::prefetch(PriorityThreadPool* executor, const std::vector<IORange>& ranges) {
+    if (_prefetch_stream == nullptr) {
+        if (_prefetch_stream_opener == nullptr) {
+            return;
+        }
+        auto stream = _prefetch_stream_opener();
+        // try it only once, the buffers are read by the caller as usual if it fails
+        _prefetch_stream_opener = nullptr;
+        if (!stream.ok()) {
+            LOG(WARNING) << "failed to open " << _filename << " for prefetch: " << stream.status();
+            return;
+        }
+        _prefetch_stream = std::move(stream).value();
+    }
+    for (const IORange& r : ranges) {
+        if (!r.is_active) {
+            continue;
+        }
+        auto ret = find_shared_buffer(r.offset, r.size);
+        if (!ret.ok()) {
+            continue;
+        }
+        SharedBuffer& sb = *ret.value();
+        if (sb.buffer.capacity() != 0 || sb.prefetch != nullptr) {
+            continue;
+        }
+        // memory is reserved by the reader thread, so that it is tracked by the query
+        if (!CurrentThread::mem_tracker()->check_mem_limit("prefetch into shared buffer").ok()) {
+            return;
+        }
+        sb.buffer.reserve(sb.size);
+        auto task = std::make_shared<PrefetchTask>();
+        uint8_t* data = sb.buffer.data();
+        int64_t read_offset = sb.offset;
+        int64_t read_size = sb.size;
+        bool ok = executor->try_offer([this, task, data, read_offset, read_size]() {
+            if (task->claimed.exchange(true)) {
+                // the reader has taken it over, |this| may be destroyed
+                return;
+            }
+            task->promise.set_value(_prefetch_read_at_fully(read_offset, data, read_size));
+        });
+        if (!ok) {
+            std::vector<uint8_t>().swap(sb.buffer);
+            return;
+        }
+        sb.prefetch = std::move(task);
+    }
+}
+
+bool SharedBufferedInputStream::_wait_prefetch(SharedBuffer& sb) {
+    auto task = std::move(sb.prefetch);
+    if (!task->claimed.exchange(true)) {
+        // not started yet, read it by the caller rather than waiting for a free thread of the executor
+        return false;
+    }
+    SCOPED_RAW_TIMER(&_shared_io_timer);
+    Status st = task->future.get();
+    if (!st.ok()) {
+        // read it again by the caller, which reports the error if it happens again
+        LOG(WARNING) << "failed to prefetch " << _filename << ", offset=" << sb.offset << ", size=" << sb.size
+                     << ": " << st;
+        return false;
+    }
+    _prefetch_io_count += 1;
+    return true;
+}
+
+void SharedBufferedInputStream::_wait_prefetch(std::map<int64_t, SharedBuffer>::iterator begin,
+                                               std::map<int64_t, SharedBuffer>::iterator end) {
+    for (auto iter = begin; iter != end; ++iter) {
+        if (iter->second.prefetch != nullptr) {
+            _wait_prefetch(iter->second);
+        }
+    }
+}
+
 void SharedBufferedInputStream::release() {
+    _wait_prefetch(_map.begin(), _map.end());
     _map.clear();
 }
 
 void SharedBufferedInputStream::release_to_offset(int64_t offset) {
     auto it = _map.upper_bound(offset);
+    _wait_prefetch(_map.begin(), it);
     _map.erase(_map.begin(), it);
 }
 
+void SharedBufferedInputStream::release_range(int64_t offset, int64_t end) {
+    auto first = _map.upper_bound(offset);
+    if (first != _map.end() && first->second.raw_offset < offset) {
+        ++first;
+    }
+    auto last = first;
+    while (last != _map.end() && last->first <= end) {
+        ++last;
+    }
+    _wait_prefetch(first, last);
+    _map.erase(first, last);
+}
+
+Status SharedBufferedInputStream::_prefetch_read_at_fully(int64_t offset, void* out, int64_t count) {
+    std::lock_guard l(_prefetch_stream_mutex);
+    return _prefetch_stream->read_at_fully(offset, out, count);
+}
+
 Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
     auto st = find_shared_buffer(offset, count);
     if (!st.ok()) {
@@ -14,13 +14,22 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 
 #include "common/status.h"
 #include "io/seekable_input_stream.h"
 
+namespace starrocks {
+class PriorityThreadPool;
+} // namespace starrocks
+
 namespace starrocks::io {
 
 class SharedBufferedInputStream : public SeekableInputStream {
@@ -37,6 +46,19 @@ public:
         static constexpr int64_t MB = 1024 * 1024;
         int64_t max_dist_size = 1 * MB;
         int64_t max_buffer_size = 8 * MB;
+        // Gaps not larger than small_dist_size are always coalesced. Larger gaps (up to max_dist_size) are
+        // only coalesced while the skipped bytes of the buffer are at most max_skip_ratio of the requested
+        // bytes, so that sparse ranges (e.g. pages selected by page index) do not read the pages in between.
+        // max_skip_ratio <= 0 disables the limit.
+        int64_t small_dist_size = 128 * 1024;
+        double max_skip_ratio = 0;
+    };
+    // Background read of a shared buffer issued by prefetch().
+    struct PrefetchTask {
+        // set by whoever runs the read, either the prefetch thread or the reader when the task is not started
+        std::atomic<bool> claimed = false;
+        std::promise<Status> promise;
+        std::future<Status> future = promise.get_future();
     };
     struct SharedBuffer {
         // request range
@@ -47,12 +69,13 @@ public:
         int64_t size;
         int64_t ref_count;
         std::vector<uint8_t> buffer;
+        std::shared_ptr<PrefetchTask> prefetch;
         void align(int64_t align_size, int64_t file_size);
         std::string debug_string() const;
     };
 
     SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, std::string filename, size_t file_size);
-    ~SharedBufferedInputStream() override = default;
+    ~SharedBufferedInputStream() override;
 
     Status seek(int64_t position) override {
         _offset = position;
@@ -75,7 +98,17 @@ public:
     }
 
     Status set_io_ranges(const std::vector<IORange>& ranges, bool coalesce_lazy_column = true);
+    // Prefetch reads go through a stream of their own, opened by |opener| on the first prefetch(), so that
+    // the reads of the caller never wait behind them. prefetch() does nothing if it is not set.
+    using StreamOpener = std::function<StatusOr<std::shared_ptr<SeekableInputStream>>()>;
+    void set_prefetch_stream_opener(StreamOpener opener) { _prefetch_stream_opener = std::move(opener); }
+    // Read the shared buffers holding the active ones of |ranges| in |executor|, so that the IO overlaps
+    // with the processing of the data before them. Buffers of lazy columns only are left to the caller.
+    // Buffers are read by the calling thread as usual if the executor is busy or the memory limit is hit.
+    void prefetch(PriorityThreadPool* executor, const std::vector<IORange>& ranges);
     void release_to_offset(int64_t offset);
+    // drop the shared buffers lying in [offset, end), e.g. to register the io ranges again
+    void release_range(int64_t offset, int64_t end);
     void release();
     void set_coalesce_options(const CoalesceOptions& options) { _options = options; }
     void set_align_size(int64_t size) { _align_size = size; }
@@ -87,18 +120,26 @@ public:
     int64_t direct_io_count() const { return _direct_io_count; }
     int64_t direct_io_bytes() const { return _direct_io_bytes; }
     int64_t direct_io_timer() const { return _direct_io_timer; }
+    int64_t prefetch_io_count() const { return _prefetch_io_count; }
     int64_t estimated_mem_usage() const { return _estimated_mem_usage; }
 
     StatusOr<std::string_view> peek(int64_t count) override;
 
 private:
     void _update_estimated_mem_usage();
+    Status _prefetch_read_at_fully(int64_t offset, void* out, int64_t count);
+    bool _wait_prefetch(SharedBuffer& sb);
+    void _wait_prefetch(std::map<int64_t, SharedBuffer>::iterator begin, std::map<int64_t, SharedBuffer>::iterator end);
     Status _get_bytes(const uint8_t** buffer, size_t offset, size_t nbytes);
     Status _sort_and_check_overlap(std::vector<IORange>& ranges);
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
     Status _set_io_ranges_active_and_lazy_columns(const std::vector<IORange>& ranges);
     const std::shared_ptr<SeekableInputStream> _stream;
+    StreamOpener _prefetch_stream_opener;
+    std::shared_ptr<SeekableInputStream> _prefetch_stream;
+    // serialize the prefetch reads, _prefetch_stream is positioned by seek
+    std::mutex _prefetch_stream_mutex;
     const std::string _filename;
     std::map<int64_t, SharedBuffer> _map;
     CoalesceOptions _options;
@@ -111,6 +152,7 @@ private:
     int64_t _direct_io_count = 0;
     int64_t _direct_io_bytes = 0;
     int64_t _direct_io_timer = 0;
+    int64_t _prefetch_io_count = 0;
     int64_t _align_size = 0;
     int64_t _estimated_mem_usage = 0;
 };
@@ -37,6 +37,7 @@
 #include <iostream>
 #include <utility>
 
+#include "common/config.h"
 #include "glog/logging.h"
 #include "runtime/current_thread.h"
 #include "runtime/data_stream_recvr.h"
@@ -217,6 +218,17 @@ void DataStreamMgr::close() {
     // from other threads.
 }
 
+void DataStreamMgr::set_credit_bytes(const TUniqueId& fragment_instance_id, PlanNodeId node_id,
+                                     PTransmitChunkResult* response) {
+    if (!config::enable_exchange_credit_flow_control) {
+        return;
+    }
+    std::shared_ptr<DataStreamRecvr> recvr = find_recvr(fragment_instance_id, node_id);
+    if (recvr != nullptr) {
+        response->set_credit_bytes(recvr->credit_bytes());
+    }
+}
+
 void DataStreamMgr::cancel(const TUniqueId& fragment_instance_id) {
     VLOG_QUERY << "cancelling all streams for fragment=" << fragment_instance_id;
     std::vector<std::shared_ptr<DataStreamRecvr>> recvrs;
@@ -99,6 +99,9 @@ public:
                                                   bool is_pipeline, int32_t degree_of_parallelism, bool keep_order);
 
     Status transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
+    // Set the credit of the receiver in |response|. It's called right before the response is sent,
+    // which may be held until the receiver has room, so that the credit reflects the current buffer.
+    void set_credit_bytes(const TUniqueId& fragment_instance_id, PlanNodeId node_id, PTransmitChunkResult* response);
     // Closes all receivers registered for fragment_instance_id immediately.
     void cancel(const TUniqueId& fragment_instance_id);
     void close();
@@ -36,6 +36,7 @@
 
 #include <util/time.h>
 
+#include <algorithm>
 #include <condition_variable>
 #include <deque>
 #include <utility>
@@ -161,6 +162,7 @@ DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtim
           _fragment_instance_id(fragment_instance_id),
           _dest_node_id(dest_node_id),
           _total_buffer_limit(total_buffer_limit),
+          _num_senders(num_senders),
           _row_desc(row_desc),
           _is_merging(is_merging),
           _num_buffered_bytes(0),
@@ -170,7 +172,8 @@ DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtim
           _sub_plan_query_statistics_recvr(std::move(sub_plan_query_statistics_recvr)),
           _is_pipeline(is_pipeline),
           _keep_order(keep_order),
-          _pass_through_context(pass_through_chunk_buffer, fragment_instance_id, dest_node_id) {
+          _pass_through_context(pass_through_chunk_buffer, fragment_instance_id, dest_node_id),
+          _chunk_size(runtime_state->chunk_size()) {
     // Create one queue per sender if is_merging is true.
     int num_queues = is_merging ? num_senders : 1;
     _sender_queues.reserve(num_queues);
@@ -195,6 +198,11 @@ DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtim
     }
 }
 
+int64_t DataStreamRecvr::credit_bytes() const {
+    int64_t free_bytes = static_cast<int64_t>(_total_buffer_limit) - static_cast<int64_t>(_num_buffered_bytes);
+    return std::max<int64_t>(0, free_bytes / std::max(1, _num_senders));
+}
+
 void DataStreamRecvr::bind_profile(int32_t driver_sequence, const std::shared_ptr<RuntimeProfile>& profile) {
     DCHECK(profile != nullptr);
     DCHECK_GE(driver_sequence, 0);
@@ -214,6 +222,8 @@ void DataStreamRecvr::bind_profile(int32_t driver_sequence, const std::shared_pt
     statistics.buffer_unplug_counter = ADD_COUNTER(profile, "BufferUnplugCount", TUnit::UNIT);
     statistics.peak_buffer_mem_bytes = profile->AddHighWaterMarkCounter(
             "PeakBufferMemoryBytes", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
+    statistics.coalesced_chunk_counter = ADD_COUNTER(profile, "CoalescedChunkCount", TUnit::UNIT);
+    statistics.coalesce_chunk_timer = ADD_TIMER(profile, "CoalesceChunkTime");
 }
 
 Status DataStreamRecvr::get_next(ChunkPtr* chunk, bool* eos) {
@@ -311,6 +321,7 @@ Status DataStreamRecvr::get_chunk_for_pipeline(std::unique_ptr<Chunk>* chunk, co
 void DataStreamRecvr::short_circuit_for_pipeline(const int32_t driver_sequence) {
     DCHECK(_is_pipeline);
     auto* sender_queue = static_cast<PipelineSenderQueue*>(_sender_queues[0]);
+    sender_queue->clear_coalesce_pending_chunk(driver_sequence);
     return sender_queue->short_circuit(driver_sequence);
 }
 
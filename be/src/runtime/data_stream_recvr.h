@@ -159,6 +159,9 @@ private:
     // total buffer limit.
     bool exceeds_limit(int chunk_size) { return _num_buffered_bytes + chunk_size > _total_buffer_limit; }
 
+    // Bytes each sender may have in flight, the free buffer is shared by all the senders.
+    int64_t credit_bytes() const;
+
     // Return a metrics for current rpc in round-robin manner.
     Metrics& get_metrics_round_robin() { return _metrics[_rpc_round_roubin_index++ % _metrics.size()]; }
 
@@ -173,6 +176,7 @@ private:
     // all sender queues. we stop acking incoming data once the amount of buffered data
     // exceeds this value
     size_t _total_buffer_limit;
+    const int _num_senders;
 
     // Row schema, copied from the caller of CreateRecvr().
     RowDescriptor _row_desc;
@@ -224,6 +228,10 @@ private:
 
         RuntimeProfile::Counter* buffer_unplug_counter = nullptr;
         RuntimeProfile::HighWaterMarkCounter* peak_buffer_mem_bytes = nullptr;
+
+        // Number of small chunks appended to the previous chunk, and time spent on it
+        RuntimeProfile::Counter* coalesced_chunk_counter = nullptr;
+        RuntimeProfile::Counter* coalesce_chunk_timer = nullptr;
     };
 
     // One DataStreamRecvr will be shared by a group of ExchangeSourceOperator
@@ -247,6 +255,8 @@ private:
     PassThroughContext _pass_through_context;
 
     int _encode_level;
+    // Rows of the chunks returned to the pipeline, the small received chunks are coalesced up to it
+    int _chunk_size;
     bool _closed = false;
 };
 
@@ -373,6 +373,16 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
     }
     _query_rpc_pool = new PriorityThreadPool("query_rpc", query_rpc_threads, std::numeric_limits<uint32_t>::max());
 
+    int num_scan_prefetch_threads = config::scan_prefetch_thread_pool_thread_num;
+    if (num_scan_prefetch_threads <= 0) {
+        num_scan_prefetch_threads = CpuInfo::num_cores();
+    }
+    if (config::scan_prefetch_thread_pool_queue_size <= 0) {
+        return Status::InvalidArgument("scan_prefetch_thread_pool_queue_size shoule be greater than 0");
+    }
+    _scan_prefetch_pool = new PriorityThreadPool("scan_prefetch", num_scan_prefetch_threads,
+                                                 config::scan_prefetch_thread_pool_queue_size);
+
     // The _load_rpc_pool now handles routine load RPC and table function RPC.
     RETURN_IF_ERROR(ThreadPoolBuilder("load_rpc") // thread pool for load rpc
                             .set_min_threads(10)
@@ -599,6 +609,10 @@ void ExecEnv::stop() {
         _query_rpc_pool->shutdown();
     }
 
+    if (_scan_prefetch_pool) {
+        _scan_prefetch_pool->shutdown();
+    }
+
     if (_load_rpc_pool) {
         _load_rpc_pool->shutdown();
     }
@@ -662,6 +676,7 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_pipeline_prepare_pool);
     SAFE_DELETE(_pipeline_sink_io_pool);
     SAFE_DELETE(_query_rpc_pool);
+    SAFE_DELETE(_scan_prefetch_pool);
     _load_rpc_pool.reset();
     SAFE_DELETE(_scan_executor);
     SAFE_DELETE(_connector_scan_executor);
@@ -40,11 +40,13 @@ public:
         DCHECK_GE(physical_bytes, 0);
         CurrentThread::current().mem_release(physical_bytes);
 
-        std::unique_lock lock(_mutex);
-        _buffer.emplace_back(std::make_pair(std::move(clone), driver_sequence));
-        _bytes.push_back(chunk_size);
-        _physical_bytes += physical_bytes;
-        _total_bytes += physical_bytes;
+        _push(std::move(clone), chunk_size, physical_bytes, driver_sequence);
+    }
+    // Take over the chunk without copy, it should not be referenced by the sender anymore.
+    void append_chunk(ChunkUniquePtr chunk, size_t chunk_size, int32_t driver_sequence) {
+        int64_t physical_bytes = chunk->memory_usage();
+        CurrentThread::current().mem_release(physical_bytes);
+        _push(std::move(chunk), chunk_size, physical_bytes, driver_sequence);
     }
     void pull_chunks(ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes) {
         std::unique_lock lock(_mutex);
@@ -58,6 +60,14 @@ public:
     }
 
 private:
+    void _push(ChunkUniquePtr chunk, size_t chunk_size, int64_t physical_bytes, int32_t driver_sequence) {
+        std::unique_lock lock(_mutex);
+        _buffer.emplace_back(std::make_pair(std::move(chunk), driver_sequence));
+        _bytes.push_back(chunk_size);
+        _physical_bytes += physical_bytes;
+        _total_bytes += physical_bytes;
+    }
+
     std::mutex _mutex; // lock-step to push/pull chunks
     ChunkUniquePtrVector _buffer;
     std::vector<size_t> _bytes;
@@ -128,6 +138,11 @@ void PassThroughContext::append_chunk(int sender_id, const Chunk* chunk, size_t
     PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
     sender_channel->append_chunk(chunk, chunk_size, driver_sequence);
 }
+void PassThroughContext::append_chunk(int sender_id, ChunkUniquePtr chunk, size_t chunk_size,
+                                      int32_t driver_sequence) {
+    PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
+    sender_channel->append_chunk(std::move(chunk), chunk_size, driver_sequence);
+}
 void PassThroughContext::pull_chunks(int sender_id, ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes) {
     PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
     sender_channel->pull_chunks(chunks, bytes);
@@ -38,7 +38,10 @@
 
 #include "column/chunk.h"
 #include "column/const_column.h"
+#include "column/nullable_column.h"
+#include "column/type_traits.h"
 #include "exprs/expr.h"
+#include "gutil/strings/fastmem.h"
 #include "runtime/buffer_control_block.h"
 #include "runtime/current_thread.h"
 #include "types/logical_type.h"
@@ -70,6 +73,9 @@ Status MysqlResultWriter::init(RuntimeState* state) {
         return Status::InternalError("no memory to alloc.");
     }
 
+    for (auto* ctx : _output_expr_ctxs) {
+        _result_types.emplace_back(ctx->root()->type().type);
+    }
     return Status::OK();
 }
 
@@ -112,15 +118,8 @@ Status MysqlResultWriter::close() {
     return Status::OK();
 }
 
-StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
-    SCOPED_TIMER(_append_chunk_timer);
-    int num_rows = chunk->num_rows();
-    auto result = std::make_unique<TFetchDataResult>();
-    auto& result_rows = result->result_batch.rows;
-    result_rows.resize(num_rows);
-
+StatusOr<Columns> MysqlResultWriter::_evaluate_columns(Chunk* chunk) {
     Columns result_columns;
-    // Step 1: compute expr
     int num_columns = _output_expr_ctxs.size();
     result_columns.reserve(num_columns);
 
@@ -131,23 +130,44 @@ StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
                          : column;
         result_columns.emplace_back(std::move(column));
     }
+    return result_columns;
+}
 
-    // Step 2: convert chunk to mysql row format row by row
-    {
-        _row_buffer->reserve(128);
-        SCOPED_TIMER(_convert_tuple_timer);
+void MysqlResultWriter::_serialize_row(const Columns& result_columns, size_t row) {
+    DCHECK_EQ(0, _row_buffer->length());
+    if (_is_binary_format) {
+        _row_buffer->start_binary_row(result_columns.size());
+    }
+    for (auto& result_column : result_columns) {
+        result_column->put_mysql_row_buffer(_row_buffer, row);
+    }
+}
+
+StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
+    SCOPED_TIMER(_append_chunk_timer);
+    int num_rows = chunk->num_rows();
+    auto result = std::make_unique<TFetchDataResult>();
+    auto& result_rows = result->result_batch.rows;
+    result_rows.resize(num_rows);
+
+    // Step 1: compute expr
+    ASSIGN_OR_RETURN(Columns result_columns, _evaluate_columns(chunk));
+
+    // Step 2: convert chunk to mysql row format
+    SCOPED_TIMER(_convert_tuple_timer);
+    if (!_is_binary_format) {
+        _text_rows_builder.build(result_columns, _result_types, num_rows);
         for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
-            if (_is_binary_format) {
-                _row_buffer->start_binary_row(num_columns);
-            };
-            for (auto& result_column : result_columns) {
-                result_column->put_mysql_row_buffer(_row_buffer, i);
-            }
-            size_t len = _row_buffer->length();
-            _row_buffer->move_content(&result_rows[i]);
-            _row_buffer->reserve(len * 1.1);
+            _text_rows_builder.copy_row(i, &result_rows[i]);
         }
+        return result;
+    }
+    _row_buffer->reserve(128);
+    for (int i = 0; i < num_rows; ++i) {
+        _serialize_row(result_columns, i);
+        size_t len = _row_buffer->length();
+        _row_buffer->move_content(&result_rows[i]);
+        _row_buffer->reserve(len * 1.1);
     }
     return result;
 }
@@ -157,59 +177,55 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
     int num_rows = chunk->num_rows();
     std::vector<TFetchDataResultPtr> results;
 
-    Columns result_columns;
     // Step 1: compute expr
-    int num_columns = _output_expr_ctxs.size();
-    result_columns.reserve(num_columns);
-
-    for (int i = 0; i < num_columns; ++i) {
-        ASSIGN_OR_RETURN(ColumnPtr column, _output_expr_ctxs[i]->evaluate(chunk));
-        column = _output_expr_ctxs[i]->root()->type().type == TYPE_TIME
-                         ? ColumnHelper::convert_time_column_from_double_to_str(column)
-                         : column;
-        result_columns.emplace_back(std::move(column));
-    }
+    ASSIGN_OR_RETURN(Columns result_columns, _evaluate_columns(chunk));
 
-    // Step 2: convert chunk to mysql row format row by row
+    // Step 2: convert chunk to mysql row format
     {
         TRY_CATCH_ALLOC_SCOPE_START()
         _row_buffer->reserve(128);
         size_t current_bytes = 0;
         int current_rows = 0;
         SCOPED_TIMER(_convert_tuple_timer);
+        if (!_is_binary_format) {
+            _text_rows_builder.build(result_columns, _result_types, num_rows);
+        }
         auto result = std::make_unique<TFetchDataResult>();
-        auto& result_rows = result->result_batch.rows;
-        result_rows.resize(num_rows);
+        auto* result_rows = &result->result_batch.rows;
+        result_rows->resize(num_rows);
 
         for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
+            size_t len = 0;
             if (_is_binary_format) {
-                _row_buffer->start_binary_row(num_columns);
+                _serialize_row(result_columns, i);
+                len = _row_buffer->length();
+            } else {
+                len = _text_rows_builder.row_length(i);
             }
-            for (auto& result_column : result_columns) {
-                result_column->put_mysql_row_buffer(_row_buffer, i);
-            }
-            size_t len = _row_buffer->length();
 
             if (UNLIKELY(current_bytes + len >= _max_row_buffer_size)) {
-                result_rows.resize(current_rows);
+                result_rows->resize(current_rows);
                 results.emplace_back(std::move(result));
 
                 result = std::make_unique<TFetchDataResult>();
-                result_rows = result->result_batch.rows;
-                result_rows.resize(num_rows - i);
+                result_rows = &result->result_batch.rows;
+                result_rows->resize(num_rows - i);
 
                 current_bytes = 0;
                 current_rows = 0;
             }
-            _row_buffer->move_content(&result_rows[current_rows]);
-            _row_buffer->reserve(len * 1.1);
+            if (_is_binary_format) {
+                _row_buffer->move_content(&(*result_rows)[current_rows]);
+                _row_buffer->reserve(len * 1.1);
+            } else {
+                _text_rows_builder.copy_row(i, &(*result_rows)[current_rows]);
+            }
 
             current_bytes += len;
             current_rows += 1;
         }
         if (current_rows > 0) {
-            result_rows.resize(current_rows);
+            result_rows->resize(current_rows);
             results.emplace_back(std::move(result));
         }
         TRY_CATCH_ALLOC_SCOPE_END()
@@ -238,4 +254,110 @@ StatusOr<bool> MysqlResultWriter::try_add_batch(TFetchDataResultPtrs& results) {
     return status;
 }
 
+// Return false without serializing anything if the column is not the one |LT| is usually stored in,
+// e.g. a LargeBinaryColumn of VARCHAR.
+template <LogicalType LT>
+static bool serialize_text_column(const Column* column, size_t num_rows, MysqlRowBuffer* buf, size_t* offsets) {
+    using ColumnType = RunTimeColumnType<LT>;
+    const uint8_t* nulls = nullptr;
+    if (column->is_nullable()) {
+        const auto* nullable_column = down_cast<const NullableColumn*>(column);
+        if (nullable_column->has_null()) {
+            nulls = nullable_column->immutable_null_column_data().data();
+        }
+        column = nullable_column->data_column().get();
+    }
+    if constexpr (lt_is_string<LT>) {
+        if (!column->is_binary()) {
+            return false;
+        }
+    }
+    const auto* data_column = down_cast<const ColumnType*>(column);
+
+    offsets[0] = 0;
+    if constexpr (lt_is_string<LT>) {
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (nulls != nullptr && nulls[i]) {
+                buf->push_null();
+            } else {
+                Slice s = data_column->get_slice(i);
+                buf->push_string(s.data, s.size);
+            }
+            offsets[i + 1] = buf->length();
+        }
+    } else {
+        const auto* data = data_column->get_data().data();
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (nulls != nullptr && nulls[i]) {
+                buf->push_null();
+            } else {
+                buf->push_number(data[i]);
+            }
+            offsets[i + 1] = buf->length();
+        }
+    }
+    return true;
+}
+
+void MysqlTextRowsBuilder::build(const Columns& columns, const std::vector<LogicalType>& types, size_t num_rows) {
+    DCHECK_EQ(columns.size(), types.size());
+    _buffers.resize(columns.size());
+    _offsets.resize(columns.size());
+    for (size_t c = 0; c < columns.size(); ++c) {
+        const Column* column = columns[c].get();
+        auto& buf = _buffers[c];
+        auto& offsets = _offsets[c];
+        buf.reset();
+        offsets.resize(num_rows + 1);
+
+        LogicalType type = column->is_constant() ? TYPE_UNKNOWN : types[c];
+        bool serialized = false;
+        switch (type) {
+#define SERIALIZE_TEXT_COLUMN(LT)                                                       \
+    case LT:                                                                            \
+        serialized = serialize_text_column<LT>(column, num_rows, &buf, offsets.data()); \
+        break;
+            SERIALIZE_TEXT_COLUMN(TYPE_BOOLEAN)
+            SERIALIZE_TEXT_COLUMN(TYPE_TINYINT)
+            SERIALIZE_TEXT_COLUMN(TYPE_SMALLINT)
+            SERIALIZE_TEXT_COLUMN(TYPE_INT)
+            SERIALIZE_TEXT_COLUMN(TYPE_BIGINT)
+            SERIALIZE_TEXT_COLUMN(TYPE_LARGEINT)
+            SERIALIZE_TEXT_COLUMN(TYPE_FLOAT)
+            SERIALIZE_TEXT_COLUMN(TYPE_DOUBLE)
+            SERIALIZE_TEXT_COLUMN(TYPE_CHAR)
+            SERIALIZE_TEXT_COLUMN(TYPE_VARCHAR)
+#undef SERIALIZE_TEXT_COLUMN
+        default:
+            break;
+        }
+        if (!serialized) {
+            offsets[0] = 0;
+            for (size_t i = 0; i < num_rows; ++i) {
+                column->put_mysql_row_buffer(&buf, i);
+                offsets[i + 1] = buf.length();
+            }
+        }
+    }
+}
+
+size_t MysqlTextRowsBuilder::row_length(size_t row) const {
+    size_t length = 0;
+    for (const auto& offsets : _offsets) {
+        length += offsets[row + 1] - offsets[row];
+    }
+    return length;
+}
+
+void MysqlTextRowsBuilder::copy_row(size_t row, std::string* dst) const {
+    raw::make_room(dst, row_length(row));
+    char* pos = dst->data();
+    for (size_t c = 0; c < _buffers.size(); ++c) {
+        size_t begin = _offsets[c][row];
+        size_t size = _offsets[c][row + 1] - begin;
+        strings::memcpy_inlined(pos, _buffers[c].data().data() + begin, size);
+        pos += size;
+    }
+}
+
 } // namespace starrocks
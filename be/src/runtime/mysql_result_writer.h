@@ -37,15 +37,36 @@
 #include "common/statusor.h"
 #include "runtime/result_writer.h"
 #include "runtime/runtime_state.h"
+#include "types/logical_type.h"
+#include "util/mysql_row_buffer.h"
 
 namespace starrocks {
 
 class ExprContext;
-class MysqlRowBuffer;
 class BufferControlBlock;
 class RuntimeProfile;
 using TFetchDataResultPtr = std::unique_ptr<TFetchDataResult>;
 using TFetchDataResultPtrs = std::vector<TFetchDataResultPtr>;
+
+// Build mysql text protocol rows column by column.
+// Each column is serialized into its own buffer in one pass, without the virtual call per value for
+// numeric and string columns, then a row is assembled by copying its cells of all the columns.
+class MysqlTextRowsBuilder {
+public:
+    // |types| are the logical types of |columns|.
+    void build(const Columns& columns, const std::vector<LogicalType>& types, size_t num_rows);
+
+    size_t row_length(size_t row) const;
+
+    // Replace |dst| with the row.
+    void copy_row(size_t row, std::string* dst) const;
+
+private:
+    std::vector<MysqlRowBuffer> _buffers;
+    // the cell of row i of column c is [_offsets[c][i], _offsets[c][i + 1]) of _buffers[c]
+    std::vector<std::vector<size_t>> _offsets;
+};
+
 // convert the row batch to mysql protocol row
 class MysqlResultWriter final : public ResultWriter {
 public:
@@ -68,11 +89,16 @@ private:
     void _init_profile();
     // this function is only used in non-pipeline engine
     StatusOr<TFetchDataResultPtr> _process_chunk(Chunk* chunk);
+    StatusOr<Columns> _evaluate_columns(Chunk* chunk);
+    // Serialize row |row| of |result_columns| into _row_buffer.
+    void _serialize_row(const Columns& result_columns, size_t row);
 
     BufferControlBlock* _sinker;
     const std::vector<ExprContext*>& _output_expr_ctxs;
     MysqlRowBuffer* _row_buffer;
     bool _is_binary_format;
+    std::vector<LogicalType> _result_types;
+    MysqlTextRowsBuilder _text_rows_builder;
 
     RuntimeProfile* _parent_profile; // parent profile from result sink. not owned
     // total time cost on append chunk operation
@@ -159,8 +159,9 @@ void RuntimeFilterPort::publish_runtime_filters(std::list<RuntimeFilterBuildDesc
         size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(state, filter,
                                                                            reinterpret_cast<uint8_t*>(rf_data->data()));
         rf_data->resize(actual_size);
+        RuntimeFilterHelper::compress_runtime_filter(&params, config::runtime_filter_compress_min_bytes);
 
-        auto passthrough_delivery = actual_size <= config::deliver_broadcast_rf_passthrough_bytes_limit;
+        auto passthrough_delivery = params.data().size() <= config::deliver_broadcast_rf_passthrough_bytes_limit;
         if (directly_send_broadcast_grf) {
             auto sender_id =
                     std::min_element(rf_desc->broadcast_grf_senders().begin(), rf_desc->broadcast_grf_senders().end(),
@@ -265,8 +266,15 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
     // to merge runtime filters
     ObjectPool* pool = &(status->pool);
     JoinRuntimeFilter* rf = nullptr;
+    std::string buffer;
+    auto data = RuntimeFilterHelper::get_runtime_filter_data(params, &buffer);
+    if (!data.ok()) {
+        LOG(WARNING) << "RuntimeFilterMerger::merge_runtime_filter. failed to decompress filter_id = " << filter_id
+                     << ", " << data.status();
+        return;
+    }
     int rf_version = RuntimeFilterHelper::deserialize_runtime_filter(
-            pool, &rf, reinterpret_cast<const uint8_t*>(params.data().data()), params.data().size());
+            pool, &rf, reinterpret_cast<const uint8_t*>(data->data), data->size);
     if (rf == nullptr) {
         // something wrong with deserialization.
         return;
@@ -377,6 +385,7 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
     size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(rf_version, out,
                                                                        reinterpret_cast<uint8_t*>(send_data->data()));
     send_data->resize(actual_size);
+    RuntimeFilterHelper::compress_runtime_filter(&request, config::runtime_filter_compress_min_bytes);
     int timeout_ms = config::send_rpc_runtime_filter_timeout_ms;
     if (_query_options.__isset.runtime_filter_send_timeout_ms) {
         timeout_ms = _query_options.runtime_filter_send_timeout_ms;
@@ -658,9 +667,16 @@ void RuntimeFilterWorker::_receive_total_runtime_filter(PTransmitRuntimeFilterPa
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker.get());
     // deserialize once, and all fragment instance shared that runtime filter.
     JoinRuntimeFilter* rf = nullptr;
-    const std::string& data = request.data();
-    RuntimeFilterHelper::deserialize_runtime_filter(nullptr, &rf, reinterpret_cast<const uint8_t*>(data.data()),
-                                                    data.size());
+    // forwarded requests keep the compressed data.
+    std::string buffer;
+    auto data = RuntimeFilterHelper::get_runtime_filter_data(request, &buffer);
+    if (!data.ok()) {
+        LOG(WARNING) << "RuntimeFilterWorker::_receive_total_runtime_filter. failed to decompress filter_id = "
+                     << request.filter_id() << ", " << data.status();
+        return;
+    }
+    RuntimeFilterHelper::deserialize_runtime_filter(nullptr, &rf, reinterpret_cast<const uint8_t*>(data->data),
+                                                    data->size);
     if (rf == nullptr) {
         return;
     }
@@ -17,6 +17,7 @@
 #include <atomic>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "gen_cpp/data.pb.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "runtime/current_thread.h"
@@ -431,7 +432,10 @@ void DataStreamRecvr::NonPipelineSenderQueue::clean_buffer_queues() {
 
 DataStreamRecvr::PipelineSenderQueue::PipelineSenderQueue(DataStreamRecvr* parent_recvr, int32_t num_senders,
                                                           int32_t degree_of_parallism)
-        : SenderQueue(parent_recvr), _num_remaining_senders(num_senders), _chunk_queue_states(degree_of_parallism) {
+        : SenderQueue(parent_recvr),
+          _num_remaining_senders(num_senders),
+          _chunk_queue_states(degree_of_parallism),
+          _coalesce_pending_chunks(degree_of_parallism) {
     for (int i = 0; i < degree_of_parallism; i++) {
         _chunk_queues.emplace_back();
     }
@@ -446,15 +450,37 @@ Status DataStreamRecvr::PipelineSenderQueue::get_chunk(Chunk** chunk, const int3
         return Status::Cancelled("Cancelled SenderQueueForPipeline::get_chunk");
     }
     size_t index = _is_pipeline_level_shuffle ? driver_sequence : 0;
+    auto& chunk_queue_state = _chunk_queue_states[index];
+
+    ChunkUniquePtr chunk_ptr = std::move(_coalesce_pending_chunks[driver_sequence]);
+    if (chunk_ptr == nullptr) {
+        ASSIGN_OR_RETURN(chunk_ptr, try_dequeue_chunk(index, driver_sequence));
+        if (chunk_ptr == nullptr) {
+            chunk_queue_state.unpluging = false;
+            VLOG_ROW << "DataStreamRecvr no new data, stop unpluging";
+            return Status::OK();
+        }
+    }
+    _total_chunks--;
+
+    if (config::enable_exchange_receiver_coalesce_chunks && !_recvr->_is_merging &&
+        chunk_ptr->num_rows() < _recvr->_chunk_size * config::exchange_receiver_coalesce_chunk_ratio) {
+        RETURN_IF_ERROR(coalesce_chunks(index, driver_sequence, chunk_ptr.get()));
+    }
+    *chunk = chunk_ptr.release();
+    VLOG_ROW << "DataStreamRecvr fetched #rows=" << (*chunk)->num_rows();
+    return Status::OK();
+}
+
+StatusOr<ChunkUniquePtr> DataStreamRecvr::PipelineSenderQueue::try_dequeue_chunk(size_t index,
+                                                                                 int32_t driver_sequence) {
     auto& chunk_queue = _chunk_queues[index];
     auto& chunk_queue_state = _chunk_queue_states[index];
     auto& metrics = _recvr->_metrics[driver_sequence];
 
     ChunkItem item;
     if (!chunk_queue.try_dequeue(item)) {
-        chunk_queue_state.unpluging = false;
-        VLOG_ROW << "DataStreamRecvr no new data, stop unpluging";
-        return Status::OK();
+        return nullptr;
     }
     DeferOp defer_op([&]() {
         auto* closure = item.closure;
@@ -470,19 +496,54 @@ Status DataStreamRecvr::PipelineSenderQueue::get_chunk(Chunk** chunk, const int3
         }
     });
 
+    ChunkUniquePtr chunk_ptr;
     if (item.chunk_ptr == nullptr) {
-        ChunkUniquePtr chunk_ptr = std::make_unique<Chunk>();
+        chunk_ptr = std::make_unique<Chunk>();
         faststring uncompressed_buffer;
         RETURN_IF_ERROR(_deserialize_chunk(item.pchunk, chunk_ptr.get(), metrics, &uncompressed_buffer));
-        *chunk = chunk_ptr.release();
     } else {
-        *chunk = item.chunk_ptr.release();
+        chunk_ptr = std::move(item.chunk_ptr);
     }
-    VLOG_ROW << "DataStreamRecvr fetched #rows=" << (*chunk)->num_rows();
 
-    _total_chunks--;
     _recvr->_num_buffered_bytes -= item.chunk_bytes;
     COUNTER_ADD(metrics.peak_buffer_mem_bytes, -item.chunk_bytes);
+    return chunk_ptr;
+}
+
+// Chunks from pass through keep the columns of the sender, which may differ from the deserialized ones
+// in nullable or const, so only chunks with the same layout are coalesced.
+static bool can_coalesce(const Chunk& dst, const Chunk& src) {
+    if (dst.num_columns() != src.num_columns() || dst.get_slot_id_to_index_map() != src.get_slot_id_to_index_map()) {
+        return false;
+    }
+    for (size_t i = 0; i < dst.num_columns(); i++) {
+        const auto& dst_column = dst.get_column_by_index(i);
+        const auto& src_column = src.get_column_by_index(i);
+        if (dst_column->is_constant() || src_column->is_constant() ||
+            dst_column->is_nullable() != src_column->is_nullable()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Status DataStreamRecvr::PipelineSenderQueue::coalesce_chunks(size_t index, int32_t driver_sequence, Chunk* chunk) {
+    auto& metrics = _recvr->_metrics[driver_sequence];
+    SCOPED_TIMER(metrics.coalesce_chunk_timer);
+    const size_t chunk_size = _recvr->_chunk_size;
+    while (chunk->num_rows() < chunk_size) {
+        ASSIGN_OR_RETURN(auto next, try_dequeue_chunk(index, driver_sequence));
+        if (next == nullptr) {
+            break;
+        }
+        if (chunk->num_rows() + next->num_rows() > chunk_size || !can_coalesce(*chunk, *next)) {
+            _coalesce_pending_chunks[driver_sequence] = std::move(next);
+            break;
+        }
+        TRY_CATCH_BAD_ALLOC(chunk->append_safe(*next));
+        _total_chunks--;
+        COUNTER_UPDATE(metrics.coalesced_chunk_counter, 1);
+    }
     return Status::OK();
 }
 
@@ -853,11 +914,22 @@ void DataStreamRecvr::PipelineSenderQueue::short_circuit(const int32_t driver_se
     }
 }
 
+void DataStreamRecvr::PipelineSenderQueue::clear_coalesce_pending_chunk(const int32_t driver_sequence) {
+    if (_coalesce_pending_chunks[driver_sequence] != nullptr) {
+        _coalesce_pending_chunks[driver_sequence].reset();
+        --_total_chunks;
+    }
+}
+
 bool DataStreamRecvr::PipelineSenderQueue::has_output(const int32_t driver_sequence) {
     if (_is_cancelled.load()) {
         return false;
     }
 
+    if (_coalesce_pending_chunks[driver_sequence] != nullptr) {
+        return true;
+    }
+
     size_t index = _is_pipeline_level_shuffle ? driver_sequence : 0;
     size_t chunk_num = _chunk_queues[index].size_approx();
     auto& chunk_queue_state = _chunk_queue_states[index];
@@ -172,6 +172,9 @@ public:
 
     void short_circuit(const int32_t driver_sequence);
 
+    // Drop the chunk kept by coalescing for |driver_sequence|, must be called by the driver itself.
+    void clear_coalesce_pending_chunk(const int32_t driver_sequence);
+
     bool has_output(const int32_t driver_sequence);
 
     bool is_finished() const;
@@ -223,6 +226,14 @@ private:
 
     Status try_to_build_chunk_meta(const PTransmitChunkParams& request, Metrics& metrics);
 
+    // Dequeue a chunk from the queue at |index|, return nullptr if the queue is empty.
+    // The closure held by the item is run, but _total_chunks is not decreased.
+    StatusOr<ChunkUniquePtr> try_dequeue_chunk(size_t index, int32_t driver_sequence);
+
+    // Append the following small chunks of the queue to |chunk| until it reaches the chunk size.
+    // The chunk which can not be appended is kept in _coalesce_pending_chunks[driver_sequence].
+    Status coalesce_chunks(size_t index, int32_t driver_sequence, Chunk* chunk);
+
     template <bool keep_order>
     Status add_chunks(const PTransmitChunkParams& request, Metrics& metrics, ::google::protobuf::Closure** done);
 
@@ -268,6 +279,10 @@ private:
 
     std::atomic<bool> _is_chunk_meta_built{false};
 
+    // Chunk dequeued during coalescing but not returned yet, one for each driver sequence.
+    // It is still counted in _total_chunks.
+    std::vector<ChunkUniquePtr> _coalesce_pending_chunks;
+
     static constexpr size_t kUnplugBufferThreshold = 16;
 };
 
@@ -127,24 +127,33 @@ void PInternalServiceImplBase<T>::_transmit_chunk(google::protobuf::RpcControlle
                                                   google::protobuf::Closure* done) {
     class WrapClosure : public google::protobuf::Closure {
     public:
-        WrapClosure(google::protobuf::Closure* done, PTransmitChunkResult* response)
-                : _done(done), _response(response) {}
+        WrapClosure(ExecEnv* exec_env, google::protobuf::Closure* done, const PTransmitChunkParams* request,
+                    PTransmitChunkResult* response)
+                : _exec_env(exec_env), _done(done), _response(response), _node_id(request->node_id()) {
+            _finst_id.hi = request->finst_id().hi();
+            _finst_id.lo = request->finst_id().lo();
+        }
         ~WrapClosure() override = default;
         void Run() override {
             std::unique_ptr<WrapClosure> self_guard(this);
             const auto response_timestamp = MonotonicNanos();
             _response->set_receiver_post_process_time(response_timestamp - _receive_timestamp);
+            // The request may be released already, so the receiver is identified by the copied ids.
+            _exec_env->stream_mgr()->set_credit_bytes(_finst_id, _node_id, _response);
             if (_done != nullptr) {
                 _done->Run();
             }
         }
 
     private:
+        ExecEnv* _exec_env;
         google::protobuf::Closure* _done;
         PTransmitChunkResult* _response;
+        TUniqueId _finst_id;
+        const PlanNodeId _node_id;
         const int64_t _receive_timestamp = MonotonicNanos();
     };
-    google::protobuf::Closure* wrapped_done = new WrapClosure(done, response);
+    google::protobuf::Closure* wrapped_done = new WrapClosure(_exec_env, done, request, response);
 
     auto begin_ts = MonotonicNanos();
     std::string transmit_info = "";
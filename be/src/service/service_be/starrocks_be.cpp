@@ -110,6 +110,13 @@ Status init_datacache(GlobalEnv* global_env) {
         cache_options.enable_cache_adaptor = starrocks::config::datacache_adaptor_enable;
         cache_options.skip_read_factor = starrocks::config::datacache_skip_read_factor;
         cache_options.engine = config::datacache_engine;
+        cache_options.enable_admission = config::datacache_admission_enable;
+        cache_options.admission_min_frequency = config::datacache_admission_min_frequency;
+        cache_options.hot_set_persist_interval_seconds = config::datacache_hot_set_persist_interval_seconds;
+        cache_options.hot_set_capacity = config::datacache_hot_set_capacity;
+        cache_options.hot_set_sample_interval = config::datacache_hot_set_sample_interval;
+        cache_options.warmup_threads = config::datacache_warmup_threads;
+        cache_options.warmup_max_bytes_per_second = config::datacache_warmup_max_bytes_per_second;
         return cache->init(cache_options);
     }
     return Status::OK();
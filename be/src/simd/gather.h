@@ -65,5 +65,37 @@ struct SIMDGather {
             c++;
         }
     }
+
+    // b[i] = a[c[i]], every c[i] must be less than buckets.
+    // TV of 4 or 8 bytes is gathered by AVX2, other types fall back to scalar copies.
+    template <class TV, class TC>
+    static void gather_values(TV* b, const TV* a, const TC* c, size_t buckets, int num_rows) {
+        static_assert(sizeof(TC) == 4);
+        static_assert(std::is_integral_v<TC>);
+        int i = 0;
+#ifdef __AVX2__
+        if constexpr (std::is_trivially_copyable_v<TV> && (sizeof(TV) == 4 || sizeof(TV) == 8)) {
+            if (buckets < max_process_size) {
+                for (; i + 8 <= num_rows; i += 8) {
+                    __m256i loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + i));
+                    if constexpr (sizeof(TV) == 4) {
+                        __m256i gathered = _mm256_i32gather_epi32(reinterpret_cast<const int*>(a), loaded, 4);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i), gathered);
+                    } else {
+                        auto* base = reinterpret_cast<const long long*>(a);
+                        __m256i low = _mm256_i32gather_epi64(base, _mm256_castsi256_si128(loaded), 8);
+                        __m256i high = _mm256_i32gather_epi64(base, _mm256_extracti128_si256(loaded, 1), 8);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i), low);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i + 4), high);
+                    }
+                }
+                _mm256_zeroupper();
+            }
+        }
+#endif
+        for (; i < num_rows; i++) {
+            b[i] = a[c[i]];
+        }
+    }
 };
 } // namespace starrocks
@@ -14,6 +14,7 @@
 
 #include "storage/compaction_task.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "runtime/current_thread.h"
@@ -194,8 +195,9 @@ void CompactionTask::_failure_callback(const Status& st) {
 }
 
 Status CompactionTask::_shortcut_compact(Statistics* statistics) {
-    // if there is only one rowset has data, we can shortcut compact
-    // shortcut compact means hard link old rowset to new rowset directly
+    // if there is only one rowset has data, or the rowsets having data do not overlap with each other,
+    // we can shortcut compact
+    // shortcut compact means hard link old rowsets to new rowset directly
     // no need to read and write data
     std::vector<RowsetSharedPtr> data_rowsets;
     for (const auto& rowset : _input_rowsets) {
@@ -209,21 +211,37 @@ Status CompactionTask::_shortcut_compact(Statistics* statistics) {
         }
     }
 
-    if (data_rowsets.size() == 1 && !data_rowsets.back()->rowset_meta()->is_segments_overlapping() &&
-        _tablet->enable_shortcut_compaction()) {
+    bool can_shortcut = false;
+    if (data_rowsets.size() == 1) {
+        can_shortcut = !data_rowsets.back()->rowset_meta()->is_segments_overlapping();
+    } else if (data_rowsets.size() > 1 && config::enable_shortcut_compaction_for_disjoint_rowsets) {
+        // several rowsets can be concatenated directly if their key ranges do not intersect, e.g. time series data
+        // loaded in key order. only large segments are linked, small ones still need to be merged.
+        can_shortcut = std::all_of(data_rowsets.begin(), data_rowsets.end(),
+                                   [](const RowsetSharedPtr& rowset) {
+                                       return static_cast<int64_t>(rowset->data_disk_size()) >=
+                                              config::shortcut_compaction_min_segment_bytes * rowset->num_segments();
+                                   }) &&
+                       CompactionUtils::sort_rowsets_by_disjoint_key_range(&data_rowsets, _tablet_schema);
+    }
+
+    if (can_shortcut && _tablet->enable_shortcut_compaction()) {
         TRACE("[Compaction] start shortcut comapction data");
         int64_t max_rows_per_segment = CompactionUtils::get_segment_max_rows(
                 config::max_segment_file_size, _task_info.input_rows_num, _task_info.input_rowsets_size);
 
         std::unique_ptr<RowsetWriter> output_rs_writer;
-        RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(_tablet.get(), max_rows_per_segment,
-                                                                        _task_info.algorithm, _task_info.output_version,
-                                                                        &output_rs_writer, _tablet_schema));
-        Status status = output_rs_writer->add_rowset(data_rowsets.back());
-        if (!status.ok()) {
-            LOG(WARNING) << "fail to compact rowset."
-                         << ", tablet=" << _tablet->full_name() << ", version=" << output_rs_writer->version();
-            return status;
+        // only horizontal rowset writer supports add_rowset
+        RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(
+                _tablet.get(), max_rows_per_segment, HORIZONTAL_COMPACTION, _task_info.output_version,
+                &output_rs_writer, _tablet_schema));
+        for (const auto& rowset : data_rowsets) {
+            Status status = output_rs_writer->add_rowset(rowset);
+            if (!status.ok()) {
+                LOG(WARNING) << "fail to compact rowset."
+                             << ", tablet=" << _tablet->full_name() << ", version=" << output_rs_writer->version();
+                return status;
+            }
         }
         StatusOr<RowsetSharedPtr> build_res = output_rs_writer->build();
         if (!build_res.ok()) {
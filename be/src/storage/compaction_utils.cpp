@@ -14,14 +14,19 @@
 
 #include "storage/compaction_utils.h"
 
+#include "column/datum_convert.h"
 #include "common/config.h"
+#include "runtime/mem_pool.h"
 #include "storage/row_source_mask.h"
+#include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
+#include "storage/rowset/segment.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet.h"
+#include "storage/types.h"
 
 namespace starrocks {
 
@@ -140,4 +145,81 @@ RowsetSharedPtr& CompactionUtils::rowset_with_max_schema_version(std::vector<Row
     });
 }
 
+bool CompactionUtils::sort_rowsets_by_disjoint_key_range(std::vector<RowsetSharedPtr>* rowsets,
+                                                         const TabletSchemaCSPtr& tablet_schema) {
+    const auto& sort_key_idxes = tablet_schema->sort_key_idxes();
+    if (sort_key_idxes.empty() || rowsets->size() < 2) {
+        return false;
+    }
+    const TabletColumn& key_column = tablet_schema->column(sort_key_idxes[0]);
+    // zone maps of decimal columns hold the unscaled values, without the precision and scale of the column
+    if (is_decimalv3_field_type(key_column.type())) {
+        return false;
+    }
+    TypeInfoPtr type_info = get_type_info(delegate_type(key_column.type()));
+    if (type_info == nullptr) {
+        return false;
+    }
+
+    struct KeyRange {
+        Datum min;
+        Datum max;
+        RowsetSharedPtr rowset;
+    };
+    MemPool mem_pool;
+    std::vector<KeyRange> ranges;
+    ranges.reserve(rowsets->size());
+    for (const auto& rowset : *rowsets) {
+        if (rowset->rowset_meta()->is_segments_overlapping() || !rowset->load().ok()) {
+            return false;
+        }
+        KeyRange range;
+        range.rowset = rowset;
+        bool has_range = false;
+        for (const auto& segment : rowset->segments()) {
+            if (segment->num_rows() == 0) {
+                continue;
+            }
+            const ColumnReader* reader = segment->column_with_uid(key_column.unique_id());
+            if (reader == nullptr || reader->segment_zone_map() == nullptr) {
+                return false;
+            }
+            const ZoneMapPB* zone_map = reader->segment_zone_map();
+            if (zone_map->has_null() || !zone_map->has_not_null()) {
+                return false;
+            }
+            Datum min;
+            Datum max;
+            if (!datum_from_string(type_info.get(), &min, zone_map->min(), &mem_pool).ok() ||
+                !datum_from_string(type_info.get(), &max, zone_map->max(), &mem_pool).ok()) {
+                return false;
+            }
+            if (!has_range || type_info->cmp(min, range.min) < 0) {
+                range.min = min;
+            }
+            if (!has_range || type_info->cmp(max, range.max) > 0) {
+                range.max = max;
+            }
+            has_range = true;
+        }
+        if (!has_range) {
+            return false;
+        }
+        ranges.emplace_back(std::move(range));
+    }
+
+    std::sort(ranges.begin(), ranges.end(),
+              [&](const KeyRange& a, const KeyRange& b) { return type_info->cmp(a.min, b.min) < 0; });
+    for (size_t i = 1; i < ranges.size(); ++i) {
+        // rows sharing the same leading key may need to be merged, so the ranges must not even touch
+        if (type_info->cmp(ranges[i - 1].max, ranges[i].min) >= 0) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        (*rowsets)[i] = std::move(ranges[i].rowset);
+    }
+    return true;
+}
+
 } // namespace starrocks
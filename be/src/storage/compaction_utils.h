@@ -70,6 +70,13 @@ public:
                                                            size_t source_num);
 
     static RowsetSharedPtr& rowset_with_max_schema_version(std::vector<RowsetSharedPtr>& rowsets);
+
+    // Check whether the key ranges of |rowsets| are disjoint, judging by the segment zone maps of the leading
+    // sort key column. If so, |rowsets| is reordered by key range and true is returned, so that their segments
+    // can be concatenated into a non-overlapping rowset without merging.
+    // Return false if any rowset is overlapping, lacks the zone map or contains null keys.
+    static bool sort_rowsets_by_disjoint_key_range(std::vector<RowsetSharedPtr>* rowsets,
+                                                   const TabletSchemaCSPtr& tablet_schema);
 };
 
 } // namespace starrocks
@@ -19,6 +19,7 @@
 #include "column/binary_column.h"
 #include "column/json_column.h"
 #include "common/logging.h"
+#include "exec/sorting/merge.h"
 #include "exec/sorting/sorting.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
@@ -135,8 +136,8 @@ size_t MemTable::memory_usage() const {
         size += _result_chunk->memory_usage();
     }
 
-    // _aggregator_memory_usage is 0 if keys type is DUP_KEYS
-    return size + _chunk_memory_usage + _aggregator_memory_usage;
+    // _sorted_runs_memory_usage is 0 if keys type is DUP_KEYS
+    return size + _chunk_memory_usage + _sorted_runs_memory_usage;
 }
 
 size_t MemTable::write_buffer_size() const {
@@ -144,8 +145,8 @@ size_t MemTable::write_buffer_size() const {
         return 0;
     }
 
-    // _aggregator_bytes_usage is 0 if keys type is DUP_KEYS
-    return _chunk_bytes_usage + _aggregator_bytes_usage;
+    // _sorted_runs_bytes_usage is 0 if keys type is DUP_KEYS
+    return _chunk_bytes_usage + _sorted_runs_bytes_usage;
 }
 
 size_t MemTable::write_buffer_rows() const {
@@ -257,33 +258,29 @@ Status MemTable::finalize() {
                 // merge last undo merge
                 RETURN_IF_ERROR(_merge());
             }
+            _chunk.reset();
+            _chunk_memory_usage = 0;
+            _chunk_bytes_usage = 0;
 
-            if (_merge_count > 1) {
-                _chunk = _aggregator->aggregate_result();
-                _aggregator->aggregate_reset();
+            // every run is sorted and aggregated already, only need to merge them
+            int64_t t1 = MonotonicMicros();
+            size_t num_runs = _sorted_runs.size();
+            RETURN_IF_ERROR(_merge_sorted_runs());
+            int64_t t2 = MonotonicMicros();
+            VLOG(1) << strings::Substitute("memtable final merge runs:$0 total:$1", num_runs, t2 - t1);
 
-                int64_t t1 = MonotonicMicros();
-                RETURN_IF_ERROR(_sort(true));
-                int64_t t2 = MonotonicMicros();
-                _aggregate(true);
-                int64_t t3 = MonotonicMicros();
-                VLOG(1) << strings::Substitute("memtable final sort:$0 agg:$1 total:$2", t2 - t1, t3 - t2, t3 - t1);
+            if (_sorted_runs.empty()) {
+                _result_chunk = ChunkHelper::new_chunk(*_vectorized_schema, 0);
             } else {
-                // if there is only one data chunk and merge once,
-                // no need to perform an additional merge.
-                _chunk.reset();
-                _result_chunk.reset();
+                _result_chunk = std::move(_sorted_runs.back());
             }
-            _chunk_memory_usage = 0;
-            _chunk_bytes_usage = 0;
+            _sorted_runs.clear();
+            _update_sorted_runs_usage();
 
-            _result_chunk = _aggregator->aggregate_result();
             if (_keys_type == PRIMARY_KEYS &&
                 PrimaryKeyEncoder::encode_exceed_limit(*_vectorized_schema, *_result_chunk.get(), 0,
                                                        _result_chunk->num_rows(), config::primary_key_limit_size)) {
                 _aggregator.reset();
-                _aggregator_memory_usage = 0;
-                _aggregator_bytes_usage = 0;
                 return Status::Cancelled("primary key size exceed the limit.");
             }
             if (_has_op_slot) {
@@ -309,8 +306,6 @@ Status MemTable::finalize() {
                 }
             }
             _aggregator.reset();
-            _aggregator_memory_usage = 0;
-            _aggregator_bytes_usage = 0;
         } else {
             RETURN_IF_ERROR(_sort(true));
         }
@@ -361,38 +356,86 @@ Status MemTable::_merge() {
     int64_t t1 = MonotonicMicros();
     RETURN_IF_ERROR(_sort(false));
     int64_t t2 = MonotonicMicros();
-    _aggregate(false);
+    if (_result_chunk->num_rows() > 0) {
+        _sorted_runs.emplace_back(_aggregate(_result_chunk));
+        _result_chunk->reset();
+    }
     int64_t t3 = MonotonicMicros();
-    VLOG(1) << strings::Substitute("memtable sort:$0 agg:$1 total:$2", t2 - t1, t3 - t2, t3 - t1);
+    if (_sorted_runs.size() > static_cast<size_t>(std::max(config::memtable_max_sorted_runs, 1))) {
+        RETURN_IF_ERROR(_merge_sorted_runs());
+    }
+    _update_sorted_runs_usage();
+    int64_t t4 = MonotonicMicros();
+    VLOG(1) << strings::Substitute("memtable sort:$0 agg:$1 merge runs:$2 total:$3", t2 - t1, t3 - t2, t4 - t3,
+                                   t4 - t1);
     ++_merge_count;
     return Status::OK();
 }
 
-void MemTable::_aggregate(bool is_final) {
-    if (_result_chunk == nullptr || _result_chunk->num_rows() <= 0) {
-        return;
-    }
-
-    DCHECK(_result_chunk->num_rows() < INT_MAX);
+ChunkPtr MemTable::_aggregate(ChunkPtr& chunk) {
+    DCHECK(chunk->num_rows() < INT_MAX);
     DCHECK(_aggregator->source_exhausted());
 
-    _aggregator->update_source(_result_chunk);
+    _aggregator->update_source(chunk);
 
     DCHECK(_aggregator->is_do_aggregate());
 
     _aggregator->aggregate();
-    _aggregator_memory_usage = _aggregator->memory_usage();
-    _aggregator_bytes_usage = _aggregator->bytes_usage();
 
     // impossible finish
     DCHECK(!_aggregator->is_finish());
     DCHECK(_aggregator->source_exhausted());
     _merged_rows = _aggregator->merged_rows();
 
-    if (is_final) {
-        _result_chunk.reset();
-    } else {
-        _result_chunk->reset();
+    ChunkPtr result = _aggregator->aggregate_result();
+    _aggregator->aggregate_reset();
+    return result;
+}
+
+Status MemTable::_merge_sorted_runs() {
+    // merge adjacent runs level by level, the earlier run is always on the left side,
+    // so the order of rows with the same key is kept as inserted.
+    while (_sorted_runs.size() > 1) {
+        std::vector<ChunkPtr> next_runs;
+        next_runs.reserve((_sorted_runs.size() + 1) / 2);
+        for (size_t i = 0; i + 1 < _sorted_runs.size(); i += 2) {
+            ASSIGN_OR_RETURN(auto merged, _merge_two_runs(_sorted_runs[i], _sorted_runs[i + 1]));
+            // release the inputs as early as possible to reduce the peak memory
+            _sorted_runs[i].reset();
+            _sorted_runs[i + 1].reset();
+            next_runs.emplace_back(_aggregate(merged));
+        }
+        if (_sorted_runs.size() % 2 == 1) {
+            next_runs.emplace_back(std::move(_sorted_runs.back()));
+        }
+        _sorted_runs.swap(next_runs);
+    }
+    return Status::OK();
+}
+
+StatusOr<ChunkPtr> MemTable::_merge_two_runs(const ChunkPtr& left, const ChunkPtr& right) {
+    // runs of primary key table are sorted by primary key, see _sort()
+    bool by_sort_key = _keys_type != KeysType::PRIMARY_KEYS;
+    Columns left_columns;
+    Columns right_columns;
+    SortDescs sort_descs;
+    RETURN_IF_ERROR(_sort_columns(*left, by_sort_key, &left_columns, &sort_descs));
+    RETURN_IF_ERROR(_sort_columns(*right, by_sort_key, &right_columns, &sort_descs));
+
+    Permutation perm;
+    RETURN_IF_ERROR(merge_sorted_chunks_two_way(sort_descs, SortedRun(left, std::move(left_columns)),
+                                                SortedRun(right, std::move(right_columns)), &perm));
+    ChunkPtr merged = left->clone_empty_with_schema(0);
+    materialize_by_permutation(merged.get(), {left, right}, perm);
+    return merged;
+}
+
+void MemTable::_update_sorted_runs_usage() {
+    _sorted_runs_memory_usage = 0;
+    _sorted_runs_bytes_usage = 0;
+    for (const auto& run : _sorted_runs) {
+        _sorted_runs_memory_usage += run->memory_usage();
+        _sorted_runs_bytes_usage += run->bytes_usage();
     }
 }
 
@@ -486,8 +529,8 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::u
     return Status::OK();
 }
 
-Status MemTable::_sort_column_inc(bool by_sort_key) {
-    Columns columns;
+Status MemTable::_sort_columns(const Chunk& chunk, bool by_sort_key, Columns* columns,
+                                SortDescs* sort_descs) const {
     std::vector<ColumnId> sort_key_idxes;
     if (by_sort_key) {
         sort_key_idxes = _vectorized_schema->sort_key_idxes();
@@ -517,20 +560,26 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
     }
 
     for (auto sort_key_idx : sort_key_idxes) {
-        columns.push_back(_chunk->get_column_by_index(sort_key_idx));
+        columns->push_back(chunk.get_column_by_index(sort_key_idx));
     }
 
-    auto sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
+    *sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
     if (!_merge_condition.empty()) {
         for (int i = 0; i < _vectorized_schema->num_fields(); ++i) {
             if (_vectorized_schema->field(i)->name() == _merge_condition) {
-                columns.push_back(_chunk->get_column_by_index(i));
-                sort_descs.descs.emplace_back(1, -1);
+                columns->push_back(chunk.get_column_by_index(i));
+                sort_descs->descs.emplace_back(1, -1);
                 break;
             }
         }
     }
+    return Status::OK();
+}
 
+Status MemTable::_sort_column_inc(bool by_sort_key) {
+    Columns columns;
+    SortDescs sort_descs;
+    RETURN_IF_ERROR(_sort_columns(*_chunk, by_sort_key, &columns, &sort_descs));
     Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
     return st;
 }
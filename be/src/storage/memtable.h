@@ -27,6 +27,7 @@ namespace starrocks {
 
 class SlotDescriptor;
 class TabletSchema;
+struct SortDescs;
 
 class MemTableSink;
 
@@ -78,8 +79,15 @@ private:
     Status _sort_column_inc(bool by_sort_key = false);
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
+    Status _sort_columns(const Chunk& chunk, bool by_sort_key, Columns* columns, SortDescs* sort_descs) const;
+
     void _init_aggregator_if_needed();
-    void _aggregate(bool is_final);
+    ChunkPtr _aggregate(ChunkPtr& chunk);
+
+    // merge all sorted runs into one, rows of the same key in different runs are aggregated
+    Status _merge_sorted_runs();
+    StatusOr<ChunkPtr> _merge_two_runs(const ChunkPtr& left, const ChunkPtr& right);
+    void _update_sorted_runs_usage();
 
     Status _split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::unique_ptr<Column>* deletes);
 
@@ -101,6 +109,8 @@ private:
 
     // aggregate
     std::unique_ptr<ChunkAggregator> _aggregator;
+    // sorted and aggregated data of each merge, in order of insertion
+    std::vector<ChunkPtr> _sorted_runs;
 
     uint64_t _merge_count = 0;
 
@@ -121,8 +131,8 @@ private:
     // so cache calculated memory usage and bytes usage to avoid repeated calculation.
     size_t _chunk_memory_usage = 0;
     size_t _chunk_bytes_usage = 0;
-    size_t _aggregator_memory_usage = 0;
-    size_t _aggregator_bytes_usage = 0;
+    size_t _sorted_runs_memory_usage = 0;
+    size_t _sorted_runs_bytes_usage = 0;
 };
 
 inline std::ostream& operator<<(std::ostream& os, const MemTable& table) {
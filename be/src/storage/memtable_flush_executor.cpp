@@ -39,6 +39,7 @@
 #include "gen_cpp/data.pb.h"
 #include "runtime/current_thread.h"
 #include "storage/memtable.h"
+#include "util/cpu_info.h"
 
 namespace starrocks {
 
@@ -134,14 +135,30 @@ void FlushToken::_flush_memtable(MemTable* memtable, SegmentPB* segment) {
     _stats.flush_size_bytes += memtable->memory_usage();
 }
 
+MemTableFlushExecutor::~MemTableFlushExecutor() {
+    // flush tasks submit to and wait on the encode pool, so they must be done before it's destroyed
+    if (_flush_pool != nullptr) {
+        _flush_pool->shutdown();
+    }
+    if (_encode_pool != nullptr) {
+        _encode_pool->shutdown();
+    }
+}
+
 Status MemTableFlushExecutor::init(const std::vector<DataDir*>& data_dirs) {
     int data_dir_num = static_cast<int>(data_dirs.size());
     int min_threads = std::max<int>(1, config::flush_thread_num_per_store);
     int max_threads = std::max(data_dir_num * min_threads, min_threads);
-    return ThreadPoolBuilder("memtable_flush") // mem table flush
-            .set_min_threads(min_threads)
-            .set_max_threads(max_threads)
-            .build(&_flush_pool);
+    RETURN_IF_ERROR(ThreadPoolBuilder("memtable_flush") // mem table flush
+                            .set_min_threads(min_threads)
+                            .set_max_threads(max_threads)
+                            .build(&_flush_pool));
+
+    int encode_threads = config::column_encode_thread_num > 0 ? config::column_encode_thread_num : CpuInfo::num_cores();
+    return ThreadPoolBuilder("column_encode") // segment column encode
+            .set_min_threads(0)
+            .set_max_threads(encode_threads)
+            .build(&_encode_pool);
 }
 
 Status MemTableFlushExecutor::update_max_threads(int max_threads) {
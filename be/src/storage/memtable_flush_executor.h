@@ -127,7 +127,7 @@ private:
 class MemTableFlushExecutor {
 public:
     MemTableFlushExecutor() = default;
-    ~MemTableFlushExecutor() = default;
+    ~MemTableFlushExecutor();
 
     // init should be called after storage engine is opened,
     // because it needs path hash of each data dir.
@@ -142,8 +142,12 @@ public:
 
     ThreadPool* get_thread_pool() { return _flush_pool.get(); }
 
+    // shared by all flushes to encode the columns of a segment in parallel
+    ThreadPool* get_encode_pool() { return _encode_pool.get(); }
+
 private:
     std::unique_ptr<ThreadPool> _flush_pool;
+    std::unique_ptr<ThreadPool> _encode_pool;
 };
 
 } // namespace starrocks
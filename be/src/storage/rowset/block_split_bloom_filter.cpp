@@ -47,15 +47,7 @@ void BlockSplitBloomFilter::add_hash(uint64_t hash) {
     DCHECK(_num_bytes >= BYTES_PER_BLOCK);
     uint32_t block_size = _num_bytes / BYTES_PER_BLOCK;
     uint32_t block_index = (uint32_t)(hash >> 32) & (block_size - 1);
-    auto key = (uint32_t)hash;
-
-    // Calculate masks for bucket.
-    uint32_t masks[8];
-    _set_masks(key, masks);
-    auto* block_offset = (uint32_t*)(_data + BYTES_PER_BLOCK * block_index);
-    for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
-        *(block_offset + i) |= masks[i];
-    }
+    _add_to_block(block_index, (uint32_t)hash);
 }
 
 bool BlockSplitBloomFilter::test_hash(uint64_t hash) const {
@@ -63,17 +55,7 @@ bool BlockSplitBloomFilter::test_hash(uint64_t hash) const {
     // power of 2)
     uint32_t block_size = _num_bytes / BYTES_PER_BLOCK;
     uint32_t block_index = (uint32_t)(hash >> 32) & (block_size - 1);
-    auto key = (uint32_t)hash;
-    // Calculate masks for bucket.
-    uint32_t masks[BITS_SET_PER_BLOCK];
-    _set_masks(key, masks);
-    auto* block_offset = (uint32_t*)(_data + BYTES_PER_BLOCK * block_index);
-    for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
-        if ((*(block_offset + i) & masks[i]) == 0) {
-            return false;
-        }
-    }
-    return true;
+    return _test_in_block(block_index, (uint32_t)hash);
 }
 
 } // namespace starrocks
@@ -49,7 +49,30 @@ public:
 
     bool test_hash(uint64_t hash) const override;
 
-private:
+protected:
+    // Set and test the bits of |key| in the |block_index|-th tiny Bloom filter block,
+    // shared by the subclasses which pick the block of a hash in other ways.
+    void _add_to_block(uint32_t block_index, uint32_t key) {
+        uint32_t masks[BITS_SET_PER_BLOCK];
+        _set_masks(key, masks);
+        auto* block_offset = (uint32_t*)(_data + BYTES_PER_BLOCK * block_index);
+        for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
+            *(block_offset + i) |= masks[i];
+        }
+    }
+
+    bool _test_in_block(uint32_t block_index, uint32_t key) const {
+        uint32_t masks[BITS_SET_PER_BLOCK];
+        _set_masks(key, masks);
+        auto* block_offset = (uint32_t*)(_data + BYTES_PER_BLOCK * block_index);
+        for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
+            if ((*(block_offset + i) & masks[i]) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void _set_masks(uint32_t key, uint32_t* masks) const {
         for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
             // add some salt to key
@@ -61,7 +84,6 @@ private:
         }
     }
 
-private:
     // Bytes in a tiny Bloom filter block.
     static const uint32_t BYTES_PER_BLOCK = 32;
 
@@ -382,9 +382,10 @@ Status Rowset::_remove_delta_column_group_files(const std::shared_ptr<FileSystem
     return Status::OK();
 }
 
-Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version) {
+Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version,
+                             uint32_t segment_id_offset) {
     for (int i = 0; i < num_segments(); ++i) {
-        std::string dst_link_path = segment_file_path(dir, new_rowset_id, i);
+        std::string dst_link_path = segment_file_path(dir, new_rowset_id, i + segment_id_offset);
         std::string src_file_path = segment_file_path(_rowset_path, rowset_id(), i);
         if (link(src_file_path.c_str(), dst_link_path.c_str()) != 0) {
             PLOG(WARNING) << "Fail to link " << src_file_path << " to " << dst_link_path;
@@ -399,7 +400,7 @@ Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId
                 const auto& index = (*(_schema->indexes()))[index_id];
                 if (index.index_type() == GIN) {
                     std::string dst_inverted_link_path = IndexDescriptor::inverted_index_file_path(
-                            dir, new_rowset_id.to_string(), segment_n, index_id);
+                            dir, new_rowset_id.to_string(), segment_n + segment_id_offset, index_id);
                     std::string src_inverted_file_path = IndexDescriptor::inverted_index_file_path(
                             _rowset_path, rowset_id().to_string(), segment_n, index_id);
 
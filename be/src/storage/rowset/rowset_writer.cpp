@@ -121,6 +121,7 @@ Status RowsetWriter::init() {
 
     _writer_options.global_dicts = _context.global_dicts != nullptr ? _context.global_dicts : nullptr;
     _writer_options.referenced_column_ids = _context.referenced_column_ids;
+    _writer_options.column_encode_pool = _context.column_encode_pool;
 
     if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS &&
         (_context.is_partial_update || !_context.merge_condition.empty() || _context.miss_auto_increment_column)) {
@@ -393,6 +394,20 @@ Status RowsetWriter::flush_segment(const SegmentPB& segment_pb, butil::IOBuf& da
     return Status::OK();
 }
 
+Status RowsetWriter::add_segment(const SegmentPB& segment_pb) {
+    std::lock_guard<std::mutex> l(_lock);
+    if (segment_pb.segment_id() != _num_segment) {
+        return Status::InternalError(
+                fmt::format("add segment {} out of order, expected segment {}", segment_pb.segment_id(), _num_segment));
+    }
+    _total_data_size += segment_pb.data_size();
+    _total_index_size += segment_pb.index_size();
+    _num_rows_written += segment_pb.num_rows();
+    _total_row_size += segment_pb.row_size();
+    _num_segment++;
+    return Status::OK();
+}
+
 HorizontalRowsetWriter::HorizontalRowsetWriter(const RowsetWriterContext& context)
         : RowsetWriter(context), _segment_writer(nullptr) {}
 
@@ -622,7 +637,7 @@ Status HorizontalRowsetWriter::flush_chunk_with_deletes(const Chunk& upserts, co
 Status HorizontalRowsetWriter::add_rowset(RowsetSharedPtr rowset) {
     TabletSharedPtr tablet = StorageEngine::instance()->tablet_manager()->get_tablet(_context.tablet_id);
     RETURN_IF_ERROR(rowset->link_files_to(tablet == nullptr ? nullptr : tablet->data_dir()->get_meta(),
-                                          _context.rowset_path_prefix, _context.rowset_id));
+                                          _context.rowset_path_prefix, _context.rowset_id, INT64_MAX, _num_segment));
     _num_rows_written += rowset->num_rows();
     _total_row_size += static_cast<int64_t>(rowset->total_row_size());
     _total_data_size += static_cast<int64_t>(rowset->rowset_meta()->data_disk_size());
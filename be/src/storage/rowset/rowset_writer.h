@@ -148,6 +148,10 @@ public:
 
     Status flush_segment(const SegmentPB& segment_pb, butil::IOBuf& data);
 
+    // Register a segment file which has already been written to the path of this rowset,
+    // e.g. by SegmentRewriter. Segments must be added in the order of their segment id.
+    Status add_segment(const SegmentPB& segment_pb);
+
     virtual Version version() { return _context.version; }
 
     virtual int64_t num_rows() { return _num_rows_written; }
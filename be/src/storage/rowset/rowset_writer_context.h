@@ -42,6 +42,7 @@
 namespace starrocks {
 
 class TabletSchema;
+class ThreadPool;
 
 enum RowsetWriterType { kHorizontal = 0, kVertical = 1 };
 
@@ -82,6 +83,9 @@ public:
 
     GlobalDictByNameMaps* global_dicts = nullptr;
 
+    // if not null, the columns of wide segments are encoded in parallel in this pool
+    ThreadPool* column_encode_pool = nullptr;
+
     RowsetWriterType writer_type = kHorizontal;
 
     std::string merge_condition;
@@ -6,8 +6,10 @@
 #include "column/column.h"
 #include "column/schema.h"
 #include "fs/fs.h"
+#include "fs/fs_util.h"
 #include "gen_cpp/segment.pb.h"
 #include "storage/chunk_helper.h"
+#include "storage/chunk_iterator.h"
 #include "storage/lake/types_fwd.h"
 #include "storage/rowset/segment.h"
 #include "storage/rowset/segment_options.h"
@@ -292,4 +294,72 @@ Status SegmentRewriter::rewrite(const std::string& src_path, const TabletSchemaC
     return Status::OK();
 }
 
+Status SegmentRewriter::rewrite_columns(const std::string& src_path, FileInfo* dest_path,
+                                        const TabletSchemaCSPtr& tschema, const std::vector<uint32_t>& column_ids,
+                                        ChunkIterator* iter, uint32_t segment_id) {
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(dest_path->path));
+    ASSIGN_OR_RETURN(auto rfile, fs->new_random_access_file(src_path));
+
+    ASSIGN_OR_RETURN(const uint64_t src_size, rfile->get_size());
+    SegmentFooterPB footer;
+    ASSIGN_OR_RETURN(const size_t src_footer_size,
+                     Segment::parse_segment_footer(rfile.get(), &footer, nullptr, nullptr));
+
+    // drop the metas of the replaced columns, SegmentWriter will add the new ones
+    std::set<int32_t> replaced_unique_ids;
+    for (uint32_t cid : column_ids) {
+        replaced_unique_ids.insert(tschema->column(cid).unique_id());
+    }
+    SegmentFooterPB kept_footer = footer;
+    kept_footer.clear_columns();
+    for (const auto& column_meta : footer.columns()) {
+        if (replaced_unique_ids.count(column_meta.unique_id()) == 0) {
+            *kept_footer.add_columns() = column_meta;
+        }
+    }
+
+    // the old footer is kept too, it will never be read because a new footer is appended at the end
+    std::unique_ptr<WritableFile> wfile;
+    auto st = fs::clone_file(src_path, dest_path->path);
+    if (st.ok()) {
+        // the bytes of src are shared with dest, only the new pages and the footer are written
+        WritableFileOptions wopts{.sync_on_close = true, .mode = FileSystem::MUST_EXIST};
+        ASSIGN_OR_RETURN(wfile, fs->new_writable_file(wopts, dest_path->path));
+    } else if (st.is_not_supported()) {
+        WritableFileOptions wopts{.sync_on_close = true, .mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
+        ASSIGN_OR_RETURN(wfile, fs->new_writable_file(wopts, dest_path->path));
+        ASSIGN_OR_RETURN(auto sfile, fs->new_sequential_file(src_path));
+        RETURN_IF_ERROR(fs::copy(sfile.get(), wfile.get(), 1024 * 1024));
+    } else {
+        return st;
+    }
+
+    SegmentWriterOptions opts;
+    SegmentWriter writer(std::move(wfile), segment_id, tschema, opts);
+    RETURN_IF_ERROR(writer.init(column_ids, false, &kept_footer));
+
+    auto chunk = ChunkHelper::new_chunk(iter->schema(), iter->chunk_size());
+    while (true) {
+        chunk->reset();
+        auto st = iter->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        RETURN_IF_ERROR(writer.append_chunk(*chunk));
+    }
+    uint64_t index_size = 0;
+    uint64_t segment_file_size;
+    RETURN_IF_ERROR(writer.finalize_columns(&index_size));
+    // the stale pages of the replaced columns are not located, their size is estimated by the new pages,
+    // which hold the same rows of the same columns
+    uint64_t new_pages_size = writer.current_filesz() - src_size;
+    writer.set_garbage_bytes(footer.garbage_bytes() + src_footer_size + new_pages_size);
+    TEST_ERROR_POINT("SegmentRewriter::rewrite_columns");
+    RETURN_IF_ERROR(writer.finalize_footer(&segment_file_size));
+
+    dest_path->size = segment_file_size;
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -16,6 +16,7 @@ namespace starrocks {
 class TabletSchema;
 
 class Column;
+class ChunkIterator;
 
 class SegmentRewriter {
 public:
@@ -40,6 +41,13 @@ public:
                           starrocks::lake::AutoIncrementPartialUpdateState& auto_increment_partial_update_state,
                           std::vector<uint32_t>& column_ids, std::vector<std::unique_ptr<Column>>* columns,
                           const starrocks::lake::TxnLogPB_OpWrite& op_write, starrocks::lake::Tablet* tablet);
+    // rewrite a segment file, replace some of it's columns with the data read from |iter|
+    // dest is a copy-on-write clone of src if the file system supports it, otherwise all bytes of src are copied
+    // to dest without decoding, either way the pages of the other columns are kept as is,
+    // the new columns are appended and the footer is rebuilt to point to them,
+    // the replaced pages and the old footer are left as garbage, whose size is recorded in the new footer
+    static Status rewrite_columns(const std::string& src_path, FileInfo* dest_path, const TabletSchemaCSPtr& tschema,
+                                  const std::vector<uint32_t>& column_ids, ChunkIterator* iter, uint32_t segment_id);
 };
 
 } // namespace starrocks
@@ -45,6 +45,7 @@
 #include "common/logging.h" // LOG
 #include "fs/fs.h"          // FileSystem
 #include "gen_cpp/segment.pb.h"
+#include "runtime/current_thread.h"
 #include "storage/inverted/index_descriptor.hpp"
 #include "storage/row_store_encoder.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
@@ -52,9 +53,11 @@
 #include "storage/seek_tuple.h"
 #include "storage/short_key_index.h"
 #include "types/logical_type.h"
+#include "util/countdown_latch.h"
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/json.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -364,13 +367,60 @@ Status SegmentWriter::_write_raw_data(const std::vector<Slice>& slices) {
     return Status::OK();
 }
 
+Status SegmentWriter::_append_columns(const Chunk& chunk) {
+    // each encode task handles at least this number of columns, to amortize the cost of scheduling
+    static constexpr size_t kMinColumnsPerTask = 8;
+
+    size_t num_columns = chunk.num_columns();
+    size_t num_tasks = 1;
+    if (_opts.column_encode_pool != nullptr && config::parallel_column_encode_min_columns > 0 &&
+        num_columns >= config::parallel_column_encode_min_columns) {
+        num_tasks = std::min<size_t>(_opts.column_encode_pool->max_threads() + 1, num_columns / kMinColumnsPerTask);
+    }
+    if (num_tasks <= 1) {
+        for (size_t i = 0; i < num_columns; ++i) {
+            RETURN_IF_ERROR(_column_writers[i]->append(*chunk.get_column_by_index(i)));
+        }
+        return Status::OK();
+    }
+
+    // Column writers are independent of each other, they encode and compress the data into in-memory pages,
+    // and nothing is written to the file until finalize, so they can be appended concurrently.
+    // The current thread takes part in the encoding, so the flush makes progress even if the pool is busy.
+    std::vector<Status> statuses(num_tasks);
+    auto encode = [&](size_t task_id) {
+        for (size_t i = task_id; i < num_columns; i += num_tasks) {
+            statuses[task_id] = _column_writers[i]->append(*chunk.get_column_by_index(i));
+            if (!statuses[task_id].ok()) {
+                break;
+            }
+        }
+    };
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    CountDownLatch latch(static_cast<int>(num_tasks - 1));
+    for (size_t task_id = 1; task_id < num_tasks; ++task_id) {
+        auto st = _opts.column_encode_pool->submit_func([&, task_id]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            encode(task_id);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            encode(task_id);
+            latch.count_down();
+        }
+    }
+    encode(0);
+    latch.wait();
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 Status SegmentWriter::append_chunk(const Chunk& chunk) {
     size_t chunk_num_rows = chunk.num_rows();
     size_t chunk_num_columns = chunk.num_columns();
-    for (size_t i = 0; i < chunk_num_columns; ++i) {
-        const Column* col = chunk.get_column_by_index(i).get();
-        RETURN_IF_ERROR(_column_writers[i]->append(*col));
-    }
+    RETURN_IF_ERROR(_append_columns(chunk));
 
     // TODO(cbl): put the fill full row column logic here is a bit hacky, this segment writer is used in many other
     //            situations(compaction etc.), so better to put it into somewhere early in the write pipeline
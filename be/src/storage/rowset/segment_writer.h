@@ -57,6 +57,7 @@ class WritableFile;
 class Chunk;
 class ColumnWriter;
 class Schema;
+class ThreadPool;
 
 extern const char* const k_segment_magic;
 extern const uint32_t k_segment_magic_length;
@@ -76,6 +77,8 @@ struct SegmentWriterOptions {
     GlobalDictByNameMaps* global_dicts = nullptr;
     std::vector<int32_t> referenced_column_ids;
     SegmentFileMark segment_file_mark;
+    // if not null, columns are encoded in parallel by this pool when the segment is wide enough
+    ThreadPool* column_encode_pool = nullptr;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
@@ -143,7 +146,12 @@ public:
 
     uint64_t current_filesz() const;
 
+    // Bytes in the file not referenced by the footer, see SegmentRewriter::rewrite_columns.
+    void set_garbage_bytes(uint64_t garbage_bytes) { _footer.set_garbage_bytes(garbage_bytes); }
+
 private:
+    // encode the columns of |chunk| by the column writers, in parallel if _opts.column_encode_pool is set
+    Status _append_columns(const Chunk& chunk);
     Status _write_short_key_index();
     Status _write_footer();
     Status _write_raw_data(const std::vector<Slice>& slices);
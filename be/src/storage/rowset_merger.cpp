@@ -18,16 +18,23 @@
 #include <queue>
 
 #include "column/binary_column.h"
+#include "fs/fs_util.h"
+#include "gen_cpp/segment.pb.h"
 #include "gutil/stl_util.h"
 #include "storage/chunk_helper.h"
+#include "storage/del_vector.h"
+#include "storage/delta_column_group.h"
 #include "storage/empty_iterator.h"
 #include "storage/merge_iterator.h"
 #include "storage/primary_key_encoder.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowset_options.h"
 #include "storage/rowset/rowset_writer.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_rewriter.h"
 #include "storage/tablet.h"
 #include "storage/union_iterator.h"
+#include "storage/update_manager.h"
 #include "util/pretty_printer.h"
 #include "util/starrocks_metrics.h"
 
@@ -640,4 +647,132 @@ Status compaction_merge_rowsets(Tablet& tablet, int64_t version, const vector<Ro
     return merger->do_merge(tablet, final_tablet_schema, version, schema, rowsets, writer, cfg);
 }
 
+StatusOr<bool> compaction_merge_column_subset(Tablet& tablet, int64_t version, const vector<RowsetSharedPtr>& rowsets,
+                                              RowsetWriter* writer, const starrocks::TabletSchemaCSPtr& tablet_schema) {
+    // row store column and inverted index files need to be rebuilt with all the columns
+    if (tablet.is_column_with_row_store() || !tablet_schema->indexes()->empty()) {
+        return false;
+    }
+    KVStore* meta = tablet.data_dir()->get_meta();
+    LocalDelvecLoader delvec_loader(meta);
+    LocalDeltaColumnGroupLoader dcg_loader(meta);
+    RowsetSharedPtr rowset;
+    for (const auto& rs : rowsets) {
+        size_t num_dels = 0;
+        const uint32_t rs_seg_id = rs->rowset_meta()->get_rowset_seg_id();
+        for (uint32_t i = 0; i < rs->num_segments(); i++) {
+            DelVectorPtr delvec;
+            RETURN_IF_ERROR(delvec_loader.load(TabletSegmentId(tablet.tablet_id(), rs_seg_id + i), version, &delvec));
+            num_dels += delvec->cardinality();
+        }
+        if (num_dels == rs->num_rows()) {
+            // rowset without live rows contributes nothing to the output
+            continue;
+        }
+        if (rowset != nullptr || num_dels > 0) {
+            return false;
+        }
+        rowset = rs;
+    }
+    if (rowset == nullptr || (rowset->num_segments() > 1 && rowset->rowset_meta()->is_segments_overlapping())) {
+        return false;
+    }
+    RETURN_IF_ERROR(rowset->load());
+
+    const uint32_t rowset_seg_id = rowset->rowset_meta()->get_rowset_seg_id();
+    const size_t num_segments = rowset->num_segments();
+    // column indexes updated by delta column groups, for each segment
+    vector<vector<uint32_t>> update_column_ids(num_segments);
+    size_t max_update_columns = 0;
+    for (size_t i = 0; i < num_segments; i++) {
+        DeltaColumnGroupList dcgs;
+        RETURN_IF_ERROR(dcg_loader.load(TabletSegmentId(tablet.tablet_id(), rowset_seg_id + i), version, &dcgs));
+        std::set<uint32_t> column_ids;
+        for (const auto& dcg : dcgs) {
+            for (const auto& unique_ids : dcg->column_ids()) {
+                for (uint32_t unique_id : unique_ids) {
+                    int32_t column_id = tablet_schema->field_index(unique_id);
+                    // the column may have been dropped by schema change
+                    if (column_id >= 0) {
+                        column_ids.insert(column_id);
+                    }
+                }
+            }
+        }
+        update_column_ids[i].assign(column_ids.begin(), column_ids.end());
+        max_update_columns = std::max(max_update_columns, column_ids.size());
+    }
+    if (max_update_columns == 0 ||
+        max_update_columns > tablet_schema->num_columns() * config::pk_column_subset_compaction_max_column_ratio) {
+        return false;
+    }
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(rowset->rowset_path()));
+    for (size_t i = 0; i < num_segments; i++) {
+        if (update_column_ids[i].empty()) {
+            continue;
+        }
+        // garbage left by previous column subset compactions is only dropped by full compaction
+        ASSIGN_OR_RETURN(auto rfile, fs->new_random_access_file(rowset->segments()[i]->file_name()));
+        ASSIGN_OR_RETURN(auto file_size, rfile->get_size());
+        SegmentFooterPB footer;
+        RETURN_IF_ERROR(Segment::parse_segment_footer(rfile.get(), &footer, nullptr, nullptr));
+        if (footer.garbage_bytes() > file_size * config::pk_column_subset_compaction_max_garbage_ratio) {
+            return false;
+        }
+    }
+
+    MonotonicStopWatch timer;
+    timer.start();
+    OlapReaderStatistics stats;
+    SegmentReadOptions seg_options;
+    seg_options.fs = fs;
+    seg_options.stats = &stats;
+    seg_options.is_primary_keys = true;
+    seg_options.tablet_id = tablet.tablet_id();
+    seg_options.rowset_id = rowset_seg_id;
+    seg_options.rowset_path = rowset->rowset_path();
+    seg_options.version = version;
+    seg_options.tablet_schema = tablet_schema;
+    seg_options.delvec_loader = std::make_shared<LocalDelvecLoader>(meta);
+    seg_options.dcg_loader = std::make_shared<LocalDeltaColumnGroupLoader>(meta);
+
+    const int64_t total_row_size = rowset->rowset_meta()->total_row_size();
+    size_t rewritten_columns = 0;
+    for (size_t i = 0; i < num_segments; i++) {
+        const auto& segment = rowset->segments()[i];
+        FileInfo dest{.path = Rowset::segment_file_path(tablet.schema_hash_path(), writer->rowset_id(), i)};
+        if (update_column_ids[i].empty()) {
+            RETURN_IF_ERROR(fs->link_file(segment->file_name(), dest.path));
+            ASSIGN_OR_RETURN(dest.size, fs->get_file_size(dest.path));
+        } else {
+            Schema schema = ChunkHelper::convert_schema(tablet_schema, update_column_ids[i]);
+            seg_options.chunk_size = calculate_chunk_size_for_column_group(schema, {rowset});
+            ASSIGN_OR_RETURN(auto iter, segment->new_iterator(schema, seg_options));
+            RETURN_IF_ERROR(SegmentRewriter::rewrite_columns(segment->file_name(), &dest, tablet_schema,
+                                                             update_column_ids[i], iter.get(), i));
+            iter->close();
+            rewritten_columns += update_column_ids[i].size();
+        }
+        SegmentPB segment_pb;
+        segment_pb.set_segment_id(i);
+        segment_pb.set_data_size(dest.size.value_or(0));
+        segment_pb.set_num_rows(segment->num_rows());
+        segment_pb.set_row_size(rowset->num_rows() > 0 ? total_row_size * segment->num_rows() / rowset->num_rows()
+                                                       : 0);
+        RETURN_IF_ERROR(writer->add_segment(segment_pb));
+    }
+    timer.stop();
+    StarRocksMetrics::instance()->update_compaction_deltas_total.increment(rowsets.size());
+    StarRocksMetrics::instance()->update_compaction_bytes_total.increment(rowset->data_disk_size());
+    StarRocksMetrics::instance()->update_compaction_outputs_total.increment(1);
+    StarRocksMetrics::instance()->update_compaction_outputs_bytes_total.increment(writer->total_data_size());
+    LOG(INFO) << "update column subset compaction finished. tablet=" << tablet.tablet_id()
+              << " rowset=" << rowset->rowset_id() << " #segment=" << num_segments
+              << " #rewritten_column=" << rewritten_columns << " rows=" << rowset->num_rows()
+              << " bytes=" << PrettyPrinter::print(rowset->data_disk_size(), TUnit::BYTES) << "->"
+              << PrettyPrinter::print(writer->total_data_size(), TUnit::BYTES)
+              << " duration: " << timer.elapsed_time() / 1000000 << "ms";
+    return true;
+}
+
 } // namespace starrocks
@@ -30,4 +30,12 @@ Status compaction_merge_rowsets(Tablet& tablet, int64_t version, const vector<Ro
                                 RowsetWriter* writer, const MergeConfig& cfg,
                                 const starrocks::TabletSchemaCSPtr& cur_tablet_schema = nullptr);
 
+// Column subset compaction for updatable tablet.
+// If there is only one rowset with live rows in |rowsets|, and it has delta column groups but no deleted rows,
+// then only the columns updated by delta column groups are read (with all their dcg files merged) and encoded,
+// the pages of other columns are copied into the output segments without decoding.
+// Return false if |rowsets| is not qualified, nothing is written into |writer| in this case.
+StatusOr<bool> compaction_merge_column_subset(Tablet& tablet, int64_t version, const vector<RowsetSharedPtr>& rowsets,
+                                              RowsetWriter* writer, const starrocks::TabletSchemaCSPtr& tablet_schema);
+
 } // namespace starrocks
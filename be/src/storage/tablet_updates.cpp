@@ -1806,9 +1806,21 @@ Status TabletUpdates::_do_compaction(std::unique_ptr<CompactionInfo>* pinfo) {
     MergeConfig cfg;
     cfg.algorithm = algorithm;
 
+    bool column_subset_compacted = false;
+    if (config::enable_pk_column_subset_compaction) {
+        auto res = compaction_merge_column_subset(_tablet, info->start_version.major_number(), input_rowsets,
+                                                  rowset_writer.get(), cur_tablet_schema);
+        if (res.ok()) {
+            column_subset_compacted = res.value();
+        } else {
+            st = res.status();
+        }
+    }
     // compaction task maybe failed if tablet is deleted
-    st = compaction_merge_rowsets(_tablet, info->start_version.major_number(), input_rowsets, rowset_writer.get(), cfg,
-                                  cur_tablet_schema);
+    if (st.ok() && !column_subset_compacted) {
+        st = compaction_merge_rowsets(_tablet, info->start_version.major_number(), input_rowsets, rowset_writer.get(),
+                                      cfg, cur_tablet_schema);
+    }
     if (!st.ok()) {
         if (_tablet.tablet_state() == TABLET_SHUTDOWN) {
             std::string msg = strings::Substitute(
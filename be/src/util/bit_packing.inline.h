@@ -35,6 +35,10 @@
 // the implement of BitPacking is from impala
 
 #include <boost/preprocessor/repetition/repeat_from_to.hpp>
+#include <type_traits>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 #include "util/bit_packing.h"
 
@@ -129,6 +133,76 @@ inline uint64_t ALWAYS_INLINE UnpackValue(const uint8_t* __restrict__ in_buf) {
     return word & mask;
 }
 
+#ifdef __AVX2__
+// Whether 32 values of BIT_WIDTH can be unpacked into OutType with Unpack32ValuesAVX2().
+// Every value is extracted from a 32 bit lane after shifting by at most 7 bits, so BIT_WIDTH must
+// be at most 25, and 16 bit outputs are narrowed from the 32 bit lanes.
+template <typename OutType, int BIT_WIDTH>
+constexpr bool CanUnpackWithAVX2() {
+    if (!std::is_integral_v<OutType> || BIT_WIDTH == 0) return false;
+    if (sizeof(OutType) == 4) return BIT_WIDTH <= 25;
+    if (sizeof(OutType) == 2) return BIT_WIDTH <= 16;
+    return false;
+}
+
+// Shuffle control and shift amounts that move the 8 values of a group of BIT_WIDTH * 8 bits into
+// 8 uint32 lanes. Values 0-3 are read from the 16 bytes starting at the first byte of the group
+// and values 4-7 from the 16 bytes starting at byte HIGH_HALF_OFFSET, because _mm256_shuffle_epi8
+// can not move bytes across 128 bit lanes.
+template <int BIT_WIDTH>
+struct Unpack8ValuesMasks {
+    static constexpr int HIGH_HALF_OFFSET = (4 * BIT_WIDTH) / 8;
+
+    int8_t shuffle[32];
+    int32_t shifts[8];
+
+    constexpr Unpack8ValuesMasks() : shuffle(), shifts() {
+        for (int i = 0; i < 8; ++i) {
+            const int first_bit = i * BIT_WIDTH;
+            const int first_byte = first_bit / 8 - (i < 4 ? 0 : HIGH_HALF_OFFSET);
+            for (int j = 0; j < 4; ++j) {
+                shuffle[i * 4 + j] = static_cast<int8_t>(first_byte + j);
+            }
+            shifts[i] = first_bit % 8;
+        }
+    }
+};
+
+// Unpack 8 values of BIT_WIDTH starting at 'in' into 8 uint32 lanes.
+// Reads up to HIGH_HALF_OFFSET + 16 bytes from 'in'.
+template <int BIT_WIDTH>
+inline __m256i ALWAYS_INLINE Unpack8ValuesAVX2(const uint8_t* __restrict__ in) {
+    static constexpr Unpack8ValuesMasks<BIT_WIDTH> masks;
+    const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    const __m128i high =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + Unpack8ValuesMasks<BIT_WIDTH>::HIGH_HALF_OFFSET));
+    __m256i values = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+    values = _mm256_shuffle_epi8(values, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(masks.shuffle)));
+    values = _mm256_srlv_epi32(values, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(masks.shifts)));
+    return _mm256_and_si256(values, _mm256_set1_epi32(static_cast<int32_t>((1UL << BIT_WIDTH) - 1)));
+}
+
+// Same as BitPacking::Unpack32Values() but unpacks 8 values per instruction sequence.
+// 'in' must have at least 32 * BIT_WIDTH / 8 + 16 addressable bytes.
+template <typename OutType, int BIT_WIDTH>
+inline const uint8_t* Unpack32ValuesAVX2(const uint8_t* __restrict__ in, OutType* __restrict__ out) {
+    static_assert(CanUnpackWithAVX2<OutType, BIT_WIDTH>());
+    for (int i = 0; i < 4; ++i) {
+        // every group of 8 values is BIT_WIDTH bytes
+        __m256i values = Unpack8ValuesAVX2<BIT_WIDTH>(in + i * BIT_WIDTH);
+        if constexpr (sizeof(OutType) == 4) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 8), values);
+        } else {
+            // [v0..v3 v0..v3 | v4..v7 v4..v7] as 16 bit values, then move v4..v7 next to v0..v3
+            __m256i packed = _mm256_packus_epi32(values, values);
+            packed = _mm256_permute4x64_epi64(packed, 0x08);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 8), _mm256_castsi256_si128(packed));
+        }
+    }
+    return in + BIT_WIDTH * 4;
+}
+#endif
+
 template <typename OutType, int BIT_WIDTH>
 std::pair<const uint8_t*, int64_t> BitPacking::UnpackValues(const uint8_t* __restrict__ in, int64_t in_bytes,
                                                             int64_t num_values, OutType* __restrict__ out) {
@@ -138,9 +212,22 @@ std::pair<const uint8_t*, int64_t> BitPacking::UnpackValues(const uint8_t* __res
     const int64_t remainder_values = values_to_read % BATCH_SIZE;
     const uint8_t* in_pos = in;
     OutType* out_pos = out;
+    int64_t i = 0;
+
+#ifdef __AVX2__
+    if constexpr (CanUnpackWithAVX2<OutType, BIT_WIDTH>()) {
+        // The AVX2 kernel reads up to 16 bytes past the batch, leave the last batches to the scalar version.
+        constexpr int64_t BATCH_BYTES = (BATCH_SIZE * BIT_WIDTH) / CHAR_BIT;
+        for (; i < batches_to_read && in_bytes >= BATCH_BYTES + 16; ++i) {
+            in_pos = Unpack32ValuesAVX2<OutType, BIT_WIDTH>(in_pos, out_pos);
+            out_pos += BATCH_SIZE;
+            in_bytes -= BATCH_BYTES;
+        }
+    }
+#endif
 
     // First unpack as many full batches as possible.
-    for (int64_t i = 0; i < batches_to_read; ++i) {
+    for (; i < batches_to_read; ++i) {
         in_pos = Unpack32Values<OutType, BIT_WIDTH>(in_pos, in_bytes, out_pos);
         out_pos += BATCH_SIZE;
         in_bytes -= (BATCH_SIZE * BIT_WIDTH) / CHAR_BIT;
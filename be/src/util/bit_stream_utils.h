@@ -194,6 +194,15 @@ public:
     template <typename T>
     int unpack_batch(int bit_width, int num_values, T* v);
 
+    // Advance the read position by 'num_bytes' bytes. Returns false if there are not enough bytes left.
+    bool skip_bytes(int64_t num_bytes) {
+        if (UNLIKELY(num_bytes > _bytes_left())) {
+            return false;
+        }
+        _buffer_pos += num_bytes;
+        return true;
+    }
+
     /// Read an unsigned ULEB-128 encoded int from the stream. The encoded int must start
     /// at the beginning of a byte. Return false if there were not enough bytes in the
     /// buffer or the int is invalid. For more details on ULEB-128:
@@ -36,6 +36,7 @@
 #include <glog/logging.h>
 
 #include "gutil/port.h"
+#include "simd/gather.h"
 #include "util/bit_stream_utils.inline.h"
 #include "util/bit_util.h"
 
@@ -707,6 +708,11 @@ public:
     // Returns the number of consumed values or 0 if an error occurred.
     int32_t GetBatch(T* values, int32_t batch_num);
 
+    // Consume 'num_values' values without decoding them. Literals are only unpacked when the
+    // skip ends in the middle of a batch of 32 values.
+    // Returns the number of skipped values or 0 if an error occurred.
+    int32_t Skip(int32_t num_values);
+
     // Like GetBatch but the values are then decoded using the provided dictionary
     template <typename TV>
     int GetBatchWithDict(const TV* dictionary, int32_t dictionary_length, TV* values, int32_t batch_num);
@@ -724,6 +730,10 @@ private:
 
     bool HaveBufferedLiterals() const { return literal_buffer_pos_ < num_buffered_literals_; }
 
+    /// Skip 'num_literals_to_skip' literals of the current literal run, must be <= NextNumLiterals().
+    /// Return false if the input was truncated.
+    bool SkipLiteralValues(int32_t num_literals_to_skip) WARN_UNUSED_RESULT;
+
     /// Output buffered literals, advancing 'literal_buffer_pos_' and decrementing
     /// 'literal_count_'. Returns the number of literals outputted.
     int32_t OutputBufferedLiterals(int32_t max_to_output, T* values);
@@ -897,6 +907,58 @@ inline int32_t RleBatchDecoder<T>::GetBatch(T* values, int32_t batch_num) {
     return num_consumed;
 }
 
+template <typename T>
+inline bool RleBatchDecoder<T>::SkipLiteralValues(int32_t num_literals_to_skip) {
+    int32_t num_skipped = 0;
+    if (HaveBufferedLiterals()) {
+        num_skipped = std::min<int32_t>(num_literals_to_skip, num_buffered_literals_ - literal_buffer_pos_);
+        literal_buffer_pos_ += num_skipped;
+        literal_count_ -= num_skipped;
+    }
+
+    // Batches of 32 literals end on a byte boundary, so they can be skipped without unpacking.
+    int32_t num_remaining = num_literals_to_skip - num_skipped;
+    int32_t num_to_bypass = std::min<int32_t>(literal_count_, BitUtil::RoundDownToPowerOf2(num_remaining, 32));
+    if (num_to_bypass > 0) {
+        if (UNLIKELY(!bit_reader_.skip_bytes(static_cast<int64_t>(num_to_bypass) / 8 * bit_width_))) return false;
+        literal_count_ -= num_to_bypass;
+        num_remaining -= num_to_bypass;
+    }
+
+    if (num_remaining > 0) {
+        if (UNLIKELY(!FillLiteralBuffer())) return false;
+        literal_buffer_pos_ += num_remaining;
+        literal_count_ -= num_remaining;
+    }
+    return true;
+}
+
+template <typename T>
+inline int32_t RleBatchDecoder<T>::Skip(int32_t num_values) {
+    DCHECK_GE(bit_width_, 0);
+    int32_t num_skipped = 0;
+    while (num_skipped < num_values) {
+        int32_t num_repeats = NextNumRepeats();
+        if (num_repeats > 0) {
+            int32_t num_repeats_to_skip = std::min(num_repeats, num_values - num_skipped);
+            GetRepeatedValue(num_repeats_to_skip);
+            num_skipped += num_repeats_to_skip;
+            continue;
+        }
+
+        int32_t num_literals = NextNumLiterals();
+        if (num_literals == 0) {
+            break;
+        }
+        int32_t num_literals_to_skip = std::min(num_literals, num_values - num_skipped);
+        if (!SkipLiteralValues(num_literals_to_skip)) {
+            return 0;
+        }
+        num_skipped += num_literals_to_skip;
+    }
+    return num_skipped;
+}
+
 template <typename T>
 static inline bool IndexInRange(T idx, int32_t dictionary_length) {
     return idx >= 0 && idx < dictionary_length;
@@ -953,9 +1015,8 @@ inline int RleBatchDecoder<T>::GetBatchWithDict(const TV* dictionary, int32_t di
         if (UNLIKELY(!IndicesInRange(indices, num_literals_to_set, dictionary_length))) {
             return -1;
         }
-        for (int i = 0; i < num_literals_to_set; ++i) {
-            values[num_consumed + i] = dictionary[indices[i]];
-        }
+        SIMDGather::gather_values(values + num_consumed, dictionary, indices, dictionary_length,
+                                  num_literals_to_set);
         num_consumed += num_literals_to_set;
     }
     return num_consumed;
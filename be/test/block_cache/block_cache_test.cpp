@@ -274,6 +274,57 @@ TEST_F(BlockCacheTest, read_cache_with_adaptor) {
     cache->shutdown();
 }
 
+TEST_F(BlockCacheTest, write_with_admission) {
+    std::unique_ptr<BlockCache> cache(new BlockCache);
+    const size_t block_size = 1024 * 1024;
+
+    CacheOptions options;
+    options.mem_space_size = 20 * 1024 * 1024;
+    options.block_size = block_size;
+    options.max_concurrent_inserts = 100000;
+    options.engine = "starcache";
+    options.enable_admission = true;
+    options.admission_min_frequency = 2;
+    Status status = cache->init(options);
+    ASSERT_TRUE(status.ok());
+
+    const size_t cache_size = 1024;
+    const std::string cache_key = "test_file";
+    std::string value(cache_size, 'a');
+    char rvalue[cache_size] = {0};
+
+    // the first miss is rejected, which is a skipped write rather than an error
+    WriteCacheOptions write_options;
+    Status st = cache->write_buffer(cache_key, 0, cache_size, value.c_str(), &write_options);
+    ASSERT_TRUE(st.ok());
+    ASSERT_TRUE(write_options.stats.skipped);
+    ASSERT_TRUE(cache->read_buffer(cache_key, 0, cache_size, rvalue).status().is_not_found());
+
+    // admitted by the second miss
+    write_options = WriteCacheOptions();
+    st = cache->write_buffer(cache_key, 0, cache_size, value.c_str(), &write_options);
+    ASSERT_TRUE(st.ok());
+    ASSERT_FALSE(write_options.stats.skipped);
+    auto res = cache->read_buffer(cache_key, 0, cache_size, rvalue);
+    ASSERT_TRUE(res.status().ok());
+    ASSERT_EQ(memcmp(rvalue, value.c_str(), cache_size), 0);
+
+    // data with positive priority skips the admission policy
+    write_options = WriteCacheOptions();
+    write_options.priority = 1;
+    st = cache->write_buffer(cache_key + "_priority", 0, cache_size, value.c_str(), &write_options);
+    ASSERT_TRUE(st.ok());
+    ASSERT_FALSE(write_options.stats.skipped);
+    ASSERT_TRUE(cache->read_buffer(cache_key + "_priority", 0, cache_size, rvalue).status().ok());
+
+    auto metrics = cache->admission_metrics();
+    ASSERT_TRUE(metrics.enabled);
+    ASSERT_EQ(2, metrics.admit_count);
+    ASSERT_EQ(1, metrics.reject_count);
+
+    cache->shutdown();
+}
+
 #endif
 
 #ifdef WITH_CACHELIB
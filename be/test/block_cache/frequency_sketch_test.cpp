@@ -0,0 +1,65 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/frequency_sketch.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace starrocks {
+
+TEST(FrequencySketchTest, test_increment) {
+    FrequencySketch sketch(1000);
+    ASSERT_EQ(1024, sketch.width());
+
+    uint64_t hash = 0x0123456789abcdefUL;
+    ASSERT_EQ(0, sketch.frequency(hash));
+    for (uint32_t i = 1; i <= FrequencySketch::MAX_FREQUENCY; i++) {
+        ASSERT_EQ(i, sketch.increment(hash));
+    }
+    // saturated
+    ASSERT_EQ(FrequencySketch::MAX_FREQUENCY, sketch.increment(hash));
+    ASSERT_EQ(FrequencySketch::MAX_FREQUENCY, sketch.frequency(hash));
+}
+
+TEST(FrequencySketchTest, test_one_hit_keys) {
+    FrequencySketch sketch(1000);
+    std::mt19937_64 rng(0);
+    int num_frequent = 0;
+    for (int i = 0; i < 200; i++) {
+        if (sketch.increment(rng()) > 1) {
+            num_frequent++;
+        }
+    }
+    // Keys seen once are rarely estimated as frequent when the sketch is not overloaded.
+    ASSERT_LE(num_frequent, 5);
+}
+
+TEST(FrequencySketchTest, test_aging) {
+    FrequencySketch sketch(1000);
+    uint64_t hash = 0x0123456789abcdefUL;
+    for (int i = 0; i < 20; i++) {
+        sketch.increment(hash);
+    }
+    // The counters are halved after 10 * capacity additions.
+    std::mt19937_64 rng(0);
+    for (int i = 0; i < 10 * 1024; i++) {
+        sketch.increment(rng());
+    }
+    ASSERT_LT(sketch.frequency(hash), FrequencySketch::MAX_FREQUENCY);
+    ASSERT_GE(sketch.frequency(hash), FrequencySketch::MAX_FREQUENCY / 2);
+}
+
+} // namespace starrocks
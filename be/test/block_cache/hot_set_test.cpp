@@ -0,0 +1,141 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/hot_set.h"
+
+#include <gtest/gtest.h>
+
+#include "fs/fs_util.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class HotSetTrackerTest : public ::testing::Test {
+protected:
+    void SetUp() override { ASSERT_OK(fs::create_directories(_dir)); }
+    void TearDown() override { ASSERT_OK(fs::remove_all(_dir)); }
+
+    std::string _dir = "./hot_set_tracker_test";
+};
+
+TEST_F(HotSetTrackerTest, test_record) {
+    HotSetTracker tracker(1024);
+    tracker.record("a/0", 100);
+    tracker.record("b/0", 200);
+    tracker.record("b/0", 50);
+    tracker.record("c/1", 300);
+    tracker.record("c/1", 400);
+    tracker.record("c/1", 10);
+    ASSERT_EQ(3, tracker.size());
+
+    auto entries = tracker.hot_entries();
+    ASSERT_EQ(3, entries.size());
+    ASSERT_EQ("c/1", entries[0].key);
+    ASSERT_EQ(400, entries[0].size);
+    ASSERT_EQ(3, entries[0].frequency);
+    ASSERT_EQ("b/0", entries[1].key);
+    ASSERT_EQ(200, entries[1].size);
+    ASSERT_EQ(2, entries[1].frequency);
+    ASSERT_EQ("a/0", entries[2].key);
+    ASSERT_EQ(1, entries[2].frequency);
+}
+
+TEST_F(HotSetTrackerTest, test_sample) {
+    HotSetTracker all(1024);
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(all.sample());
+    }
+
+    HotSetTracker tracker(1024, 4);
+    int sampled = 0;
+    for (int i = 0; i < 400; i++) {
+        if (tracker.sample()) {
+            sampled++;
+            tracker.record("a/0", 100);
+        }
+    }
+    ASSERT_EQ(100, sampled);
+    ASSERT_EQ(100, tracker.hot_entries()[0].frequency);
+
+    // Each tracker counts its own accesses.
+    HotSetTracker tracker1(1024, 2);
+    HotSetTracker tracker2(1024, 2);
+    int sampled1 = 0;
+    int sampled2 = 0;
+    for (int i = 0; i < 100; i++) {
+        sampled1 += tracker1.sample();
+        sampled2 += tracker2.sample();
+    }
+    ASSERT_EQ(50, sampled1);
+    ASSERT_EQ(50, sampled2);
+}
+
+TEST_F(HotSetTrackerTest, test_capacity) {
+    HotSetTracker tracker(64);
+    tracker.record("hot", 100);
+    tracker.record("hot", 100);
+    for (int i = 0; i < 1000; i++) {
+        tracker.record(std::to_string(i), 100);
+    }
+    // The tracker never grows beyond its capacity, the blocks accessed once are dropped by decaying.
+    ASSERT_LE(tracker.size(), 64);
+    auto entries = tracker.hot_entries();
+    ASSERT_FALSE(entries.empty());
+}
+
+TEST_F(HotSetTrackerTest, test_scan_keeps_hot_blocks) {
+    HotSetTracker tracker(64);
+    for (int i = 0; i < 10; i++) {
+        tracker.record("hot", 100);
+    }
+    // A scan of cold blocks only decays the hot block instead of evicting it.
+    for (int i = 0; i < 1000; i++) {
+        tracker.record(std::to_string(i), 100);
+    }
+    ASSERT_LE(tracker.size(), 64);
+    auto entries = tracker.hot_entries();
+    ASSERT_FALSE(entries.empty());
+    ASSERT_EQ("hot", entries[0].key);
+    ASSERT_GT(entries[0].frequency, 1);
+}
+
+TEST_F(HotSetTrackerTest, test_save_and_load) {
+    HotSetTracker tracker(1024);
+    for (int i = 0; i < 100; i++) {
+        for (int j = 0; j <= i % 5; j++) {
+            tracker.record("block/" + std::to_string(i), 1000 + i);
+        }
+    }
+    auto entries = tracker.hot_entries();
+    std::string path = _dir + "/hot_set";
+    ASSERT_OK(HotSetTracker::save(path, entries));
+
+    ASSIGN_OR_ABORT(auto loaded, HotSetTracker::load(path));
+    ASSERT_EQ(entries.size(), loaded.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        ASSERT_EQ(entries[i].key, loaded[i].key);
+        ASSERT_EQ(entries[i].size, loaded[i].size);
+        ASSERT_EQ(entries[i].frequency, loaded[i].frequency);
+    }
+
+    // corrupted manifest
+    ASSIGN_OR_ABORT(auto file, fs::new_writable_file(path));
+    ASSERT_OK(file->append("corrupted hot set"));
+    ASSERT_OK(file->close());
+    ASSERT_TRUE(HotSetTracker::load(path).status().is_corruption());
+
+    ASSERT_TRUE(HotSetTracker::load(_dir + "/not_exist").status().is_not_found());
+}
+
+} // namespace starrocks
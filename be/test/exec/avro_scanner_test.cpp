@@ -1023,4 +1023,76 @@ TEST_F(AvroScannerTest, test_root_array) {
     EXPECT_EQ("DIAMONDS", chunk->get(0)[4].get_slice());
 }
 
+TEST_F(AvroScannerTest, test_schema_values) {
+    std::string schema_path = "./be/test/exec/test_data/avro_scanner/avro_basic_schema.json";
+    AvroHelper avro_helper;
+    init_avro_value(schema_path, avro_helper);
+    DeferOp avro_helper_deleter([&] {
+        avro_schema_decref(avro_helper.schema);
+        avro_value_iface_decref(avro_helper.iface);
+        avro_value_decref(&avro_helper.avro_val);
+    });
+
+    // binary encoded messages without the framing of the schema registry
+    auto encode = [&](int64_t long_val, const char* string_val) {
+        avro_value_t field;
+        avro_value_get_by_name(&avro_helper.avro_val, "booleantype", &field, NULL);
+        avro_value_set_boolean(&field, true);
+        avro_value_get_by_name(&avro_helper.avro_val, "longtype", &field, NULL);
+        avro_value_set_long(&field, long_val);
+        avro_value_get_by_name(&avro_helper.avro_val, "doubletype", &field, NULL);
+        avro_value_set_double(&field, 1.5);
+        avro_value_get_by_name(&avro_helper.avro_val, "stringtype", &field, NULL);
+        avro_value_set_string(&field, string_val);
+        avro_value_get_by_name(&avro_helper.avro_val, "enumtype", &field, NULL);
+        avro_value_set_enum(&field, 1);
+        std::string buf(1024, '\0');
+        avro_writer_t writer = avro_writer_memory(buf.data(), buf.size());
+        EXPECT_EQ(0, avro_value_write(writer, &avro_helper.avro_val));
+        buf.resize(avro_writer_tell(writer));
+        avro_writer_free(writer);
+        return buf;
+    };
+    auto get_long = [](avro_value_t* value) {
+        avro_value_t field;
+        int64_t long_val = 0;
+        EXPECT_EQ(0, avro_value_get_by_name(value, "longtype", &field, NULL));
+        EXPECT_EQ(0, avro_value_get_long(&field, &long_val));
+        return long_val;
+    };
+    auto get_string = [](avro_value_t* value) {
+        avro_value_t field;
+        const char* str = nullptr;
+        size_t size = 0;
+        EXPECT_EQ(0, avro_value_get_by_name(value, "stringtype", &field, NULL));
+        EXPECT_EQ(0, avro_value_get_string(&field, &str, &size));
+        // size includes the trailing NUL
+        return std::string(str, size - 1);
+    };
+
+    AvroSchemaValues schema_values;
+    std::string msg1 = encode(4294967296, "abcdefg");
+    ASSIGN_OR_ABORT(auto value1, schema_values.read(1, avro_helper.schema, msg1.data(), msg1.size()));
+    EXPECT_EQ(4294967296, get_long(value1));
+    EXPECT_EQ("abcdefg", get_string(value1));
+
+    // the value of the schema is reused by the next message
+    std::string msg2 = encode(-1, "xyz");
+    ASSIGN_OR_ABORT(auto value2, schema_values.read(1, avro_helper.schema, msg2.data(), msg2.size()));
+    EXPECT_EQ(value1, value2);
+    EXPECT_EQ(-1, get_long(value2));
+    EXPECT_EQ("xyz", get_string(value2));
+    EXPECT_EQ(1, schema_values.num_schemas());
+
+    // another schema id gets a value of its own
+    ASSIGN_OR_ABORT(auto value3, schema_values.read(2, avro_helper.schema, msg1.data(), msg1.size()));
+    EXPECT_NE(value1, value3);
+    EXPECT_EQ(4294967296, get_long(value3));
+    EXPECT_EQ(-1, get_long(value1));
+    EXPECT_EQ(2, schema_values.num_schemas());
+
+    // truncated message
+    ASSERT_FALSE(schema_values.read(1, avro_helper.schema, msg1.data(), msg1.size() / 2).ok());
+}
+
 } // namespace starrocks
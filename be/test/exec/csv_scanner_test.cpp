@@ -803,6 +803,38 @@ TEST_P(CSVScannerTest, test_ENCLOSE) {
     EXPECT_EQ("ab\"c", chunk->get(6)[2].get_slice());
 }
 
+TEST_P(CSVScannerTest, test_ENCLOSE_long_fields) {
+    std::vector<TypeDescriptor> types{TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_VARCHAR),
+                                      TypeDescriptor(TYPE_VARCHAR)};
+
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.__set_num_of_columns_from_file(3);
+    range.__set_path("./be/test/exec/test_data/csv_scanner/csv_file24");
+    ranges.push_back(range);
+
+    auto scanner = create_csv_scanner(types, ranges, "\n", "|", 0, false, '"', '\\');
+    Status st = scanner->open();
+    ASSERT_TRUE(st.ok()) << st.to_string();
+
+    ChunkPtr chunk = scanner->get_next().value();
+    EXPECT_EQ(3, chunk->num_rows());
+
+    EXPECT_EQ(1, chunk->get(0)[0].get_int32());
+    EXPECT_EQ(2, chunk->get(1)[0].get_int32());
+    EXPECT_EQ(3, chunk->get(2)[0].get_int32());
+
+    // delimiters, escapes and encloses appear after more than one SIMD block of ordinary characters.
+    EXPECT_EQ("the quick brown fox jumps over the lazy dog|and then|some more", chunk->get(0)[1].get_slice());
+    EXPECT_EQ("a long enclosed value with a newline after many bytes\nsecond line of the value",
+              chunk->get(1)[1].get_slice());
+    EXPECT_EQ("an ordinary field that is long enough to fill a vector block", chunk->get(2)[1].get_slice());
+
+    EXPECT_EQ("plain value that is longer than thirty two bytes", chunk->get(0)[2].get_slice());
+    EXPECT_EQ("an enclosed value with an escaped quote \" near the end", chunk->get(1)[2].get_slice());
+    EXPECT_EQ("with doubled \"quotes\" after a long prefix of characters", chunk->get(2)[2].get_slice());
+}
+
 TEST_P(CSVScannerTest, test_ESCAPE) {
     std::vector<TypeDescriptor> types{TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_VARCHAR),
                                       TypeDescriptor(TYPE_VARCHAR)};
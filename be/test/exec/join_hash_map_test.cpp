@@ -16,9 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include "column/binary_column.h"
+#include "exec/hash_join_node.h"
+#include "exprs/runtime_filter_bank.h"
 #include "runtime/descriptor_helper.h"
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
+#include "testutil/assert.h"
 
 namespace starrocks {
 class JoinHashMapTest : public ::testing::Test {
@@ -2363,4 +2367,161 @@ TEST_F(JoinHashMapTest, NullAwareAntiJoinTest) {
     ASSERT_EQ(probe_state.probe_match_index[1], 1);
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, PrepareKeyColumnsBeforeBuild) {
+    auto runtime_profile = create_runtime_profile();
+    auto runtime_state = create_runtime_state();
+
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+
+    std::shared_ptr<RowDescriptor> row_desc =
+            create_row_desc(runtime_state.get(), _object_pool, &row_desc_builder, false);
+    std::shared_ptr<RowDescriptor> probe_row_desc =
+            create_probe_desc(runtime_state.get(), _object_pool, &row_desc_builder, false);
+    std::shared_ptr<RowDescriptor> build_row_desc =
+            create_build_desc(runtime_state.get(), _object_pool, &row_desc_builder, false);
+
+    HashTableParam param;
+    param.with_other_conjunct = false;
+    param.join_type = TJoinOp::INNER_JOIN;
+    param.row_desc = row_desc.get();
+    param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+    param.search_ht_timer = ADD_TIMER(runtime_profile, "SearchHashTableTime");
+    param.output_build_column_timer = ADD_TIMER(runtime_profile, "OutputBuildColumnTime");
+    param.output_probe_column_timer = ADD_TIMER(runtime_profile, "OutputProbeColumnTime");
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+
+    auto build_chunk = create_int32_build_chunk(10, false);
+    Columns build_key_columns{build_chunk->columns()[0]};
+    hash_table.append_chunk(build_chunk, build_key_columns);
+
+    // the runtime filters are created from the prepared key columns before the hash map is built
+    ASSERT_OK(hash_table.prepare_key_columns());
+    ASSERT_EQ(0, hash_table.get_bucket_size());
+    const ColumnPtr& key_column = hash_table.get_key_columns()[0];
+    ASSERT_EQ(11, key_column->size());
+    auto* filter = RuntimeFilterHelper::create_runtime_bloom_filter(_object_pool.get(), TYPE_INT);
+    filter->init(hash_table.get_row_count());
+    ASSERT_OK(RuntimeFilterHelper::fill_runtime_bloom_filter(key_column, TYPE_INT, filter, kHashJoinKeyColumnOffset,
+                                                             false));
+    auto* bloom_filter = down_cast<RuntimeBloomFilter<TYPE_INT>*>(filter);
+    ASSERT_EQ(0, bloom_filter->min_value());
+    ASSERT_EQ(9, bloom_filter->max_value());
+    ASSERT_FALSE(bloom_filter->has_null());
+
+    // rows appended after the key columns are prepared are still built into the hash map
+    auto build_chunk2 = std::make_shared<Chunk>();
+    build_chunk2->append_column(create_int32_column(5, 100), 3);
+    build_chunk2->append_column(create_int32_column(5, 110), 4);
+    build_chunk2->append_column(create_int32_column(5, 120), 5);
+    Columns build_key_columns2{build_chunk2->columns()[0]};
+    hash_table.append_chunk(build_chunk2, build_key_columns2);
+    ASSERT_OK(hash_table.build(runtime_state.get()));
+    ASSERT_GT(hash_table.get_bucket_size(), 0);
+
+    auto probe_chunk = create_int32_probe_chunk(5, 101, false);
+    Columns probe_key_columns{probe_chunk->columns()[0]};
+    ChunkPtr result_chunk = std::make_shared<Chunk>();
+    bool eos = false;
+    ASSERT_OK(hash_table.probe(runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos));
+
+    // keys 101..104 match the second build chunk, 105 matches nothing
+    ASSERT_EQ(result_chunk->num_columns(), 6);
+    ASSERT_EQ(result_chunk->num_rows(), 4);
+    check_int32_column(result_chunk->get_column_by_slot_id(0), 4, 101);
+    check_int32_column(result_chunk->get_column_by_slot_id(1), 4, 111);
+    check_int32_column(result_chunk->get_column_by_slot_id(3), 4, 101);
+    check_int32_column(result_chunk->get_column_by_slot_id(4), 4, 111);
+    check_int32_column(result_chunk->get_column_by_slot_id(5), 4, 121);
+
+    hash_table.close();
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, PrepareLargeKeyColumnsBeforeBuild) {
+    auto runtime_profile = create_runtime_profile();
+    auto runtime_state = create_runtime_state();
+
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_VARCHAR, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_VARCHAR, false);
+
+    std::shared_ptr<RowDescriptor> row_desc =
+            create_row_desc(runtime_state.get(), _object_pool, &row_desc_builder, false);
+    std::shared_ptr<RowDescriptor> probe_row_desc =
+            create_probe_desc(runtime_state.get(), _object_pool, &row_desc_builder, false);
+    std::shared_ptr<RowDescriptor> build_row_desc =
+            create_build_desc(runtime_state.get(), _object_pool, &row_desc_builder, false);
+
+    HashTableParam param;
+    param.with_other_conjunct = false;
+    param.join_type = TJoinOp::INNER_JOIN;
+    param.row_desc = row_desc.get();
+    param.join_keys.emplace_back(JoinKeyDesc{&_varchar_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+    param.search_ht_timer = ADD_TIMER(runtime_profile, "SearchHashTableTime");
+    param.output_build_column_timer = ADD_TIMER(runtime_profile, "OutputBuildColumnTime");
+    param.output_probe_column_timer = ADD_TIMER(runtime_profile, "OutputProbeColumnTime");
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+
+    auto build_chunk = create_binary_build_chunk(10, false, _mem_pool.get());
+    Columns build_key_columns{build_chunk->columns()[0]};
+    hash_table.append_chunk(build_chunk, build_key_columns);
+
+    // the columns that overflow 4GB are upgraded to large binary columns, do it by hand with small data
+    auto to_large_binary_column = [](const ColumnPtr& column) -> ColumnPtr {
+        auto large_column = LargeBinaryColumn::create();
+        for (const Slice& slice : ColumnHelper::as_raw_column<BinaryColumn>(column)->get_data()) {
+            large_column->append(slice);
+        }
+        return large_column;
+    };
+    for (auto& column : hash_table.get_build_chunk()->columns()) {
+        column = to_large_binary_column(column);
+    }
+    hash_table.get_key_columns()[0] = to_large_binary_column(hash_table.get_key_columns()[0]);
+
+    ASSERT_OK(hash_table.prepare_key_columns());
+    ASSERT_EQ(0, hash_table.get_bucket_size());
+    const ColumnPtr& key_column = hash_table.get_key_columns()[0];
+    ASSERT_TRUE(key_column->is_large_binary());
+    ASSERT_EQ(11, key_column->size());
+    // no bloom filter is built from a large binary column
+    auto* filter = RuntimeFilterHelper::create_runtime_bloom_filter(_object_pool.get(), TYPE_VARCHAR);
+    filter->init(hash_table.get_row_count());
+    ASSERT_TRUE(RuntimeFilterHelper::fill_runtime_bloom_filter(key_column, TYPE_VARCHAR, filter,
+                                                               kHashJoinKeyColumnOffset, false)
+                        .is_not_supported());
+
+    ASSERT_OK(hash_table.build(runtime_state.get()));
+
+    auto probe_chunk = create_binary_probe_chunk(5, 1, false, _mem_pool.get());
+    Columns probe_key_columns{probe_chunk->columns()[0]};
+    ChunkPtr result_chunk = std::make_shared<Chunk>();
+    bool eos = false;
+    ASSERT_OK(hash_table.probe(runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos));
+
+    // the result is the same as joining the binary columns
+    ASSERT_EQ(result_chunk->num_columns(), 6);
+    ASSERT_EQ(result_chunk->num_rows(), 5);
+    ASSERT_FALSE(result_chunk->has_large_column());
+    check_binary_column(result_chunk->get_column_by_slot_id(0), 5, 1);
+    check_binary_column(result_chunk->get_column_by_slot_id(1), 5, 11);
+    check_binary_column(result_chunk->get_column_by_slot_id(2), 5, 21);
+    check_binary_column(result_chunk->get_column_by_slot_id(3), 5, 1);
+    check_binary_column(result_chunk->get_column_by_slot_id(4), 5, 11);
+    check_binary_column(result_chunk->get_column_by_slot_id(5), 5, 21);
+
+    hash_table.close();
+}
+
 } // namespace starrocks
@@ -0,0 +1,336 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/sink_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "common/config.h"
+#include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/query_context.h"
+#include "gen_cpp/internal_service.pb.h"
+#include "runtime/exec_env.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/await.h"
+#include "util/defer_op.h"
+#include "util/failpoint/fail_point.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks::pipeline {
+
+// Keeps the transmit requests instead of sending them, and responds them when asked.
+// The closures must not be run in transmit_chunk, since SinkBuffer sends the request with the lock held.
+class MockTransmitStub final : public PInternalService_Stub {
+public:
+    MockTransmitStub() : PInternalService_Stub(nullptr) {}
+
+    void transmit_chunk(google::protobuf::RpcController* controller, const PTransmitChunkParams* request,
+                        PTransmitChunkResult* response, google::protobuf::Closure* done) override {
+        std::lock_guard<std::mutex> l(_mutex);
+        _requests.emplace_back(*request);
+        _pending.emplace_back(response, done);
+    }
+
+    size_t num_requests() {
+        std::lock_guard<std::mutex> l(_mutex);
+        return _requests.size();
+    }
+
+    size_t num_pending() {
+        std::lock_guard<std::mutex> l(_mutex);
+        return _pending.size();
+    }
+
+    PTransmitChunkParams request(size_t i) {
+        std::lock_guard<std::mutex> l(_mutex);
+        return _requests[i];
+    }
+
+    // Respond the pending requests successfully, with |credit_bytes| if it's not negative.
+    void respond(int64_t credit_bytes = -1) {
+        std::vector<std::pair<PTransmitChunkResult*, google::protobuf::Closure*>> pending;
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            pending.swap(_pending);
+        }
+        for (auto& [response, done] : pending) {
+            Status::OK().to_protobuf(response->mutable_status());
+            if (credit_bytes >= 0) {
+                response->set_credit_bytes(credit_bytes);
+            }
+            done->Run();
+        }
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<PTransmitChunkParams> _requests;
+    std::vector<std::pair<PTransmitChunkResult*, google::protobuf::Closure*>> _pending;
+};
+
+class SinkBufferTest : public ::testing::Test {
+public:
+    void SetUp() override;
+    void TearDown() override;
+
+protected:
+    static constexpr PlanNodeId kDestNodeId = 1;
+
+    // Create a sink buffer with one destination and one sinker.
+    void _create_buffer();
+
+    // Add a request with |chunk_bytes| bytes of chunks, which are handed over by pass through, or serialized
+    // into the attachment otherwise.
+    void _add_request(bool eos, bool use_pass_through, int64_t chunk_bytes = 0);
+
+    int64_t _counter_value(const std::string& name);
+
+    void _set_fail_point(const std::string& name, FailPointTriggerModeType mode);
+
+    ExecEnv* _exec_env = nullptr;
+    QueryContext* _query_ctx = nullptr;
+    FragmentContext* _fragment_ctx = nullptr;
+    TUniqueId _query_id;
+    TUniqueId _fragment_instance_id;
+    TUniqueId _dest_instance_id;
+    TNetworkAddress _brpc_addr;
+    MockTransmitStub _stub;
+    std::unique_ptr<SinkBuffer> _buffer;
+};
+
+void SinkBufferTest::SetUp() {
+    static std::atomic<int64_t> s_next_id{1};
+    int64_t id = s_next_id++;
+    _query_id.hi = 20240102;
+    _query_id.lo = id;
+    _fragment_instance_id.hi = 20240102;
+    _fragment_instance_id.lo = id;
+    _dest_instance_id.hi = 20240103;
+    _dest_instance_id.lo = id;
+    _brpc_addr.__set_hostname("127.0.0.1");
+    _brpc_addr.__set_port(config::brpc_port);
+    _exec_env = ExecEnv::GetInstance();
+
+    TQueryOptions query_options;
+    query_options.__set_query_timeout(60);
+    TQueryGlobals query_globals;
+
+    _query_ctx = _exec_env->query_context_mgr()->get_or_register(_query_id);
+    _query_ctx->set_total_fragments(1);
+    _query_ctx->set_delivery_expire_seconds(60);
+    _query_ctx->set_query_expire_seconds(60);
+    _query_ctx->extend_delivery_lifetime();
+    _query_ctx->extend_query_lifetime();
+    _query_ctx->init_mem_tracker(GlobalEnv::GetInstance()->query_pool_mem_tracker()->limit(),
+                                 GlobalEnv::GetInstance()->query_pool_mem_tracker());
+
+    _fragment_ctx = _query_ctx->fragment_mgr()->get_or_register(_fragment_instance_id);
+    _fragment_ctx->set_query_id(_query_id);
+    _fragment_ctx->set_fragment_instance_id(_fragment_instance_id);
+    _fragment_ctx->set_runtime_state(std::make_unique<RuntimeState>(_query_id, _fragment_instance_id,
+                                                                    query_options, query_globals, _exec_env));
+    auto* runtime_state = _fragment_ctx->runtime_state();
+    runtime_state->init_mem_trackers(_query_ctx->mem_tracker());
+    runtime_state->set_query_ctx(_query_ctx);
+    runtime_state->set_fragment_ctx(_fragment_ctx);
+}
+
+void SinkBufferTest::TearDown() {
+    if (_buffer != nullptr) {
+        // Run the remaining closures, so that the buffer can be destructed.
+        _stub.respond();
+        ASSERT_TRUE(Awaitility().timeout(5 * 1000 * 1000).until([this] { return _buffer->is_finished(); }));
+        _buffer.reset();
+    }
+}
+
+void SinkBufferTest::_create_buffer() {
+    TPlanFragmentDestination destination;
+    destination.__set_fragment_instance_id(_dest_instance_id);
+    destination.__set_brpc_server(_brpc_addr);
+    _buffer = std::make_unique<SinkBuffer>(_fragment_ctx, std::vector<TPlanFragmentDestination>{destination}, false);
+    _buffer->incr_sinker(_fragment_ctx->runtime_state());
+}
+
+void SinkBufferTest::_add_request(bool eos, bool use_pass_through, int64_t chunk_bytes) {
+    auto params = std::make_shared<PTransmitChunkParams>();
+    params->set_node_id(kDestNodeId);
+    params->set_sender_id(0);
+    params->set_be_number(0);
+    params->set_eos(eos);
+    params->set_use_pass_through(use_pass_through);
+    butil::IOBuf attachment;
+    if (!use_pass_through && chunk_bytes > 0) {
+        params->add_chunks()->set_data_size(chunk_bytes);
+        attachment.resize(chunk_bytes);
+    }
+    TransmitChunkInfo info{_dest_instance_id, &_stub, std::move(params), std::move(attachment), 0, _brpc_addr,
+                           use_pass_through ? chunk_bytes : 0};
+    ASSERT_OK(_buffer->add_request(info));
+}
+
+int64_t SinkBufferTest::_counter_value(const std::string& name) {
+    RuntimeProfile profile("SinkBufferTest");
+    _buffer->update_profile(&profile);
+    auto* counter = profile.get_counter(name);
+    return counter == nullptr ? -1 : counter->value();
+}
+
+void SinkBufferTest::_set_fail_point(const std::string& name, FailPointTriggerModeType mode) {
+    auto* fp = failpoint::FailPointRegistry::GetInstance()->get(name);
+    ASSERT_TRUE(fp != nullptr);
+    PFailPointTriggerMode trigger_mode;
+    trigger_mode.set_mode(mode);
+    fp->setMode(trigger_mode);
+}
+
+TEST_F(SinkBufferTest, test_pass_through_in_process) {
+    auto old_bypass = config::enable_exchange_pass_through_bypass_brpc;
+    DeferOp defer([old_bypass]() { config::enable_exchange_pass_through_bypass_brpc = old_bypass; });
+    config::enable_exchange_pass_through_bypass_brpc = true;
+
+    _create_buffer();
+    _add_request(true, true);
+
+    // The request is delivered in a bthread without the stub.
+    ASSERT_TRUE(Awaitility().timeout(5 * 1000 * 1000).until([this] { return _buffer->is_finished(); }));
+    ASSERT_EQ(0u, _stub.num_requests());
+}
+
+TEST_F(SinkBufferTest, test_pass_through_fall_back_to_brpc) {
+    auto old_bypass = config::enable_exchange_pass_through_bypass_brpc;
+    DeferOp defer([this, old_bypass]() {
+        config::enable_exchange_pass_through_bypass_brpc = old_bypass;
+        _set_fail_point("sink_buffer_start_in_process_transmit_failed", FailPointTriggerModeType::DISABLE);
+    });
+    config::enable_exchange_pass_through_bypass_brpc = true;
+    _set_fail_point("sink_buffer_start_in_process_transmit_failed", FailPointTriggerModeType::ENABLE);
+
+    _create_buffer();
+    _add_request(true, true);
+
+    // The bthread can not be started, so the request is sent by brpc.
+    ASSERT_EQ(1u, _stub.num_requests());
+    ASSERT_TRUE(_stub.request(0).use_pass_through());
+    ASSERT_TRUE(_stub.request(0).eos());
+    ASSERT_FALSE(_buffer->is_finished());
+
+    _stub.respond();
+    ASSERT_TRUE(_buffer->is_finished());
+}
+
+TEST_F(SinkBufferTest, test_pass_through_by_brpc_if_bypass_disabled) {
+    auto old_bypass = config::enable_exchange_pass_through_bypass_brpc;
+    DeferOp defer([old_bypass]() { config::enable_exchange_pass_through_bypass_brpc = old_bypass; });
+    config::enable_exchange_pass_through_bypass_brpc = false;
+
+    _create_buffer();
+    _add_request(true, true);
+
+    ASSERT_EQ(1u, _stub.num_requests());
+    _stub.respond();
+    ASSERT_TRUE(_buffer->is_finished());
+}
+
+TEST_F(SinkBufferTest, test_credit_starvation_and_refresh) {
+    auto old_credit = config::enable_exchange_credit_flow_control;
+    DeferOp defer([old_credit]() { config::enable_exchange_credit_flow_control = old_credit; });
+    config::enable_exchange_credit_flow_control = true;
+
+    _create_buffer();
+    // no credit is granted before the first response
+    _add_request(false, false, 100);
+    ASSERT_EQ(1u, _stub.num_requests());
+    _stub.respond(150);
+
+    _add_request(false, false, 100);
+    ASSERT_EQ(2u, _stub.num_requests());
+    // 100 bytes are in flight, another 100 bytes exceed the credit
+    _add_request(false, false, 100);
+    ASSERT_EQ(2u, _stub.num_requests());
+    ASSERT_EQ(1, _counter_value("CreditStarvedCount"));
+
+    // the response refreshes the credit, and the starved request is sent
+    _stub.respond(300);
+    ASSERT_EQ(3u, _stub.num_requests());
+    _add_request(false, false, 100);
+    ASSERT_EQ(4u, _stub.num_requests());
+    ASSERT_EQ(1, _counter_value("CreditStarvedCount"));
+
+    _stub.respond(300);
+    _add_request(true, false);
+    ASSERT_EQ(5u, _stub.num_requests());
+    _stub.respond(300);
+    ASSERT_TRUE(_buffer->is_finished());
+}
+
+TEST_F(SinkBufferTest, test_zero_credit_without_deadlock) {
+    auto old_credit = config::enable_exchange_credit_flow_control;
+    DeferOp defer([old_credit]() { config::enable_exchange_credit_flow_control = old_credit; });
+    config::enable_exchange_credit_flow_control = true;
+
+    _create_buffer();
+    _add_request(false, false, 100);
+    _stub.respond(0);
+
+    // a destination with nothing in flight is always sent to, so its credit keeps being refreshed
+    for (size_t i = 2; i <= 4; i++) {
+        _add_request(false, false, 100);
+        ASSERT_EQ(i, _stub.num_requests());
+        _add_request(false, false, 100);
+        ASSERT_EQ(i, _stub.num_requests());
+        _stub.respond(0);
+        ASSERT_EQ(i + 1, _stub.num_requests());
+        _stub.respond(0);
+    }
+
+    _add_request(true, false);
+    _stub.respond(0);
+    ASSERT_TRUE(_buffer->is_finished());
+}
+
+TEST_F(SinkBufferTest, test_credit_counts_pass_through_bytes) {
+    auto old_credit = config::enable_exchange_credit_flow_control;
+    auto old_bypass = config::enable_exchange_pass_through_bypass_brpc;
+    DeferOp defer([old_credit, old_bypass]() {
+        config::enable_exchange_credit_flow_control = old_credit;
+        config::enable_exchange_pass_through_bypass_brpc = old_bypass;
+    });
+    config::enable_exchange_credit_flow_control = true;
+    config::enable_exchange_pass_through_bypass_brpc = false;
+
+    _create_buffer();
+    _add_request(false, true, 100);
+    _stub.respond(150);
+
+    // the chunks are not in the request, but they are buffered by the receiver all the same
+    _add_request(false, true, 100);
+    _add_request(false, true, 100);
+    ASSERT_EQ(2u, _stub.num_requests());
+    _stub.respond(150);
+    ASSERT_EQ(3u, _stub.num_requests());
+
+    _stub.respond(150);
+    _add_request(true, true);
+    _stub.respond(150);
+    ASSERT_TRUE(_buffer->is_finished());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/tablet_sink_sender.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::stream_load {
+
+class TabletSinkSenderTest : public testing::Test {
+protected:
+    void SetUp() override {
+        // tablet 100: be 1, 2; tablet 101: be 2, 3; tablet 102: be 3, 1
+        _tablet_to_be[100] = {1, 2};
+        _tablet_to_be[101] = {2, 3};
+        _tablet_to_be[102] = {3, 1};
+        _tablet_ids = {100, 101, 102, 100, 100, 102};
+    }
+
+    std::unordered_map<int64_t, std::vector<int64_t>> _tablet_to_be;
+    std::vector<int64_t> _tablet_ids;
+};
+
+TEST_F(TabletSinkSenderTest, route_rows_to_all_replicas) {
+    std::unordered_map<int64_t, size_t> node_positions{{1, 0}, {2, 1}, {3, 2}};
+    std::vector<std::vector<uint32_t>> node_selections(3);
+    std::vector<uint16_t> selection_idx{0, 1, 2, 3, 4, 5};
+    TabletSinkSender::route_rows_to_nodes(_tablet_ids, selection_idx, _tablet_to_be, node_positions, false,
+                                          &node_selections);
+    EXPECT_EQ((std::vector<uint32_t>{0, 2, 3, 4, 5}), node_selections[0]);
+    EXPECT_EQ((std::vector<uint32_t>{0, 1, 3, 4}), node_selections[1]);
+    EXPECT_EQ((std::vector<uint32_t>{1, 2, 5}), node_selections[2]);
+}
+
+TEST_F(TabletSinkSenderTest, route_rows_to_primary_replica) {
+    std::unordered_map<int64_t, size_t> node_positions{{1, 0}, {2, 1}, {3, 2}};
+    std::vector<std::vector<uint32_t>> node_selections(3);
+    std::vector<uint16_t> selection_idx{1, 2, 4};
+    TabletSinkSender::route_rows_to_nodes(_tablet_ids, selection_idx, _tablet_to_be, node_positions, true,
+                                          &node_selections);
+    EXPECT_EQ((std::vector<uint32_t>{4}), node_selections[0]);
+    EXPECT_EQ((std::vector<uint32_t>{1}), node_selections[1]);
+    EXPECT_EQ((std::vector<uint32_t>{2}), node_selections[2]);
+}
+
+TEST_F(TabletSinkSenderTest, route_rows_skip_failed_nodes) {
+    // be 2 is failed and not in the positions
+    std::unordered_map<int64_t, size_t> node_positions{{1, 0}, {3, 1}};
+    std::vector<std::vector<uint32_t>> node_selections(2);
+    std::vector<uint16_t> selection_idx{0, 1, 2, 3, 4, 5};
+    TabletSinkSender::route_rows_to_nodes(_tablet_ids, selection_idx, _tablet_to_be, node_positions, false,
+                                          &node_selections);
+    EXPECT_EQ((std::vector<uint32_t>{0, 2, 3, 4, 5}), node_selections[0]);
+    EXPECT_EQ((std::vector<uint32_t>{1, 2, 5}), node_selections[1]);
+}
+
+} // namespace starrocks::stream_load
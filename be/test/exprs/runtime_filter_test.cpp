@@ -21,6 +21,7 @@
 #include <utility>
 
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "exprs/runtime_filter_bank.h"
 #include "simd/simd.h"
 
@@ -205,6 +206,47 @@ TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterSerialize) {
     EXPECT_TRUE(rf1->check_equal(*rf0));
 }
 
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterCompress) {
+    // a sparse filter sized for far more rows than inserted
+    RuntimeBloomFilter<TYPE_INT> bf0;
+    JoinRuntimeFilter* rf0 = &bf0;
+    bf0.init(1000000);
+    for (int i = 0; i <= 2000; i += 17) {
+        bf0.insert(i);
+    }
+
+    PTransmitRuntimeFilterParams params;
+    std::string* data = params.mutable_data();
+    data->resize(RuntimeFilterHelper::max_runtime_filter_serialized_size(rf0));
+    data->resize(RuntimeFilterHelper::serialize_runtime_filter(RF_VERSION_V2, rf0, (uint8_t*)data->data()));
+    size_t raw_size = data->size();
+
+    // disabled by default, since the receivers may not support it
+    RuntimeFilterHelper::compress_runtime_filter(&params, config::runtime_filter_compress_min_bytes);
+    EXPECT_FALSE(params.has_compression_type());
+    RuntimeFilterHelper::compress_runtime_filter(&params, 0);
+    EXPECT_FALSE(params.has_compression_type());
+
+    // too small to compress
+    RuntimeFilterHelper::compress_runtime_filter(&params, raw_size + 1);
+    EXPECT_FALSE(params.has_compression_type());
+
+    RuntimeFilterHelper::compress_runtime_filter(&params, 1);
+    EXPECT_EQ(CompressionTypePB::LZ4, params.compression_type());
+    EXPECT_EQ(raw_size, params.uncompressed_size());
+    EXPECT_LT(params.data().size(), raw_size);
+
+    std::string buffer;
+    auto res = RuntimeFilterHelper::get_runtime_filter_data(params, &buffer);
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(raw_size, res->size);
+    JoinRuntimeFilter* rf1 = nullptr;
+    ObjectPool pool;
+    RuntimeFilterHelper::deserialize_runtime_filter(&pool, &rf1, (const uint8_t*)res->data, res->size);
+    ASSERT_TRUE(rf1 != nullptr);
+    EXPECT_TRUE(rf1->check_equal(*rf0));
+}
+
 TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterSerialize2) {
     RuntimeBloomFilter<TYPE_INT> bf0;
     JoinRuntimeFilter* rf0 = &bf0;
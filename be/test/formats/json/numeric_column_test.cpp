@@ -66,6 +66,28 @@ TEST_F(AddNumericColumnTest, test_add_invalid) {
     ASSERT_TRUE(st.is_invalid_argument());
 }
 
+TEST_F(AddNumericColumnTest, test_add_number_to_int) {
+    auto column = FixedLengthColumn<int32_t>::create();
+    TypeDescriptor t(TYPE_INT);
+
+    simdjson::ondemand::parser parser;
+    auto json = R"(  { "f_int": -12, "f_uint": 4294967295, "f_float": 3.9}  )"_padded;
+    auto doc = parser.iterate(json);
+    simdjson::ondemand::value val = doc.find_field("f_int");
+    auto st = add_numeric_column<int32_t>(column.get(), t, "f_int", &val);
+    ASSERT_TRUE(st.ok());
+
+    val = doc.find_field("f_uint");
+    st = add_numeric_column<int32_t>(column.get(), t, "f_uint", &val);
+    ASSERT_TRUE(st.is_invalid_argument());
+
+    val = doc.find_field("f_float");
+    st = add_numeric_column<int32_t>(column.get(), t, "f_float", &val);
+    ASSERT_TRUE(st.ok());
+
+    ASSERT_EQ("[-12, 3]", column->debug_string());
+}
+
 TEST_F(AddNumericColumnTest, test_add_int_overflow) {
     auto column = FixedLengthColumn<int32_t>::create();
     TypeDescriptor t(TYPE_INT);
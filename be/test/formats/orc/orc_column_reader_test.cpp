@@ -90,4 +90,78 @@ TEST(OrcColumnReaderTest, TestDateColumn) {
     }
 }
 
+TEST(OrcColumnReaderTest, TestDirectStringColumn) {
+    const static size_t batchSize = 5;
+    const std::vector<std::string> values = {"a", "", "hello", "starrocks", "orc"};
+
+    MemoryOutputStream buffer(bufferSize);
+    ORC_UNIQUE_PTR<orc::Type> schema(orc::Type::buildTypeFromString("struct<c0:string>"));
+    const orc::Type* orcType = schema->getSubtype(0);
+
+    // prepare data.
+    {
+        orc::WriterOptions writerOptions;
+        // always use direct encoding
+        writerOptions.setDictionaryKeySizeThreshold(0);
+        ORC_UNIQUE_PTR<orc::Writer> writer = createWriter(*schema, &buffer, writerOptions);
+
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = writer->createRowBatch(batchSize);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* c0 = dynamic_cast<orc::StringVectorBatch*>(root->fields[0]);
+
+        for (size_t i = 0; i < batchSize; i++) {
+            c0->data[i] = const_cast<char*>(values[i].data());
+            c0->length[i] = values[i].size();
+            c0->notNull[i] = 1;
+        }
+        c0->notNull[2] = 0;
+        c0->hasNulls = true;
+
+        c0->numElements = batchSize;
+        root->numElements = batchSize;
+        writer->add(*batch);
+        writer->close();
+    }
+
+    // read
+    {
+        orc::ReaderOptions readerOptions;
+        ORC_UNIQUE_PTR<orc::InputStream> inputStream(new MemoryInputStream(buffer.getData(), buffer.getLength()));
+        ORC_UNIQUE_PTR<orc::Reader> reader = createReader(std::move(inputStream), readerOptions);
+
+        orc::RowReaderOptions options;
+        std::list<std::string> columns = {"c0"};
+        options.include(columns);
+        ORC_UNIQUE_PTR<orc::RowReader> rr = reader->createRowReader(options);
+
+        const OrcMappingPtr orcMapping = nullptr;
+        OrcChunkReader orcChunkReader(batchSize, {});
+        orcChunkReader.disable_broker_load_mode();
+
+        TypeDescriptor c0Type = TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR);
+
+        std::unique_ptr<ORCColumnReader> orcColumnReader =
+                ORCColumnReader::create(c0Type, orcType, true, orcMapping, &orcChunkReader).value();
+
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = rr->createRowBatch(batchSize);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* c0 = dynamic_cast<orc::StringVectorBatch*>(root->fields[0]);
+        orc::RowReader::ReadPosition pos;
+        EXPECT_TRUE(rr->next(*batch, &pos));
+        EXPECT_TRUE(c0->is_contiguous);
+
+        // fill in two steps to check the offsets of an appended range.
+        ColumnPtr column = ColumnHelper::create_column(c0Type, true);
+        EXPECT_TRUE(orcColumnReader->get_next(c0, column, 0, 2).ok());
+        EXPECT_TRUE(orcColumnReader->get_next(c0, column, 2, 3).ok());
+        EXPECT_EQ(batchSize, column->size());
+
+        EXPECT_EQ("'a'", column->debug_item(0));
+        EXPECT_EQ("''", column->debug_item(1));
+        EXPECT_EQ("NULL", column->debug_item(2));
+        EXPECT_EQ("'starrocks'", column->debug_item(3));
+        EXPECT_EQ("'orc'", column->debug_item(4));
+    }
+}
+
 } // namespace starrocks
\ No newline at end of file
@@ -18,6 +18,7 @@
 
 #include "column/binary_column.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "formats/parquet/encoding_dict.h"
 #include "formats/parquet/encoding_plain.h"
 
@@ -423,6 +424,40 @@ TEST_F(ParquetEncodingTest, String) {
     }
 }
 
+TEST_F(ParquetEncodingTest, DictValuesWithNulls) {
+    std::vector<std::string> values;
+    std::vector<Slice> slices;
+    for (int i = 0; i < 4; i++) {
+        values.push_back("value_" + std::to_string(i));
+    }
+    for (const auto& value : values) {
+        slices.emplace_back(value);
+    }
+
+    PlainEncoder<Slice> encoder;
+    ASSERT_TRUE(encoder.append((const uint8_t*)slices.data(), slices.size()).ok());
+    PlainDecoder<Slice> plain_decoder;
+    ASSERT_TRUE(plain_decoder.set_data(encoder.build()).ok());
+    DictDecoder<Slice> decoder;
+    ASSERT_TRUE(decoder.set_dict(config::vector_chunk_size, slices.size(), &plain_decoder).ok());
+
+    std::vector<int32_t> dict_codes{3, 2, 1, 0, 3};
+    auto nulls = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    nulls->resize(dict_codes.size());
+    std::vector<uint8_t> null_flags{0, 1, 0, 1, 0};
+    memcpy(nulls->null_column_data().data(), null_flags.data(), null_flags.size());
+    nulls->update_has_null();
+
+    auto column = BinaryColumn::create();
+    ASSERT_TRUE(decoder.get_dict_values(dict_codes, *nulls, column.get()).ok());
+    ASSERT_EQ(dict_codes.size(), column->size());
+    for (size_t i = 0; i < dict_codes.size(); i++) {
+        // null rows are decoded as empty values
+        Slice expected = null_flags[i] ? Slice() : slices[dict_codes[i]];
+        ASSERT_EQ(expected, column->get_slice(i));
+    }
+}
+
 TEST_F(ParquetEncodingTest, FixedString) {
     std::vector<std::string> values;
     for (int i = 100; i < 200; i++) {
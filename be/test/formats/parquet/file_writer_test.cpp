@@ -26,13 +26,18 @@
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
 #include "common/statusor.h"
+#include "exprs/column_ref.h"
+#include "exprs/in_const_predicate.hpp"
+#include "formats/parquet/bloom_filter.h"
 #include "formats/parquet/file_reader.h"
 #include "formats/parquet/parquet_test_util/util.h"
+#include "formats/parquet/parquet_ut_base.h"
 #include "fs/fs.h"
 #include "fs/fs_memory.h"
 #include "gutil/casts.h"
 #include "runtime/descriptor_helper.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::parquet {
 
@@ -663,6 +668,143 @@ TEST_F(FileWriterTest, TestWriteVarbinary) {
     Utils::assert_equal_chunk(chunk.get(), read_chunk.get());
 }
 
+TEST_F(FileWriterTest, TestWriteBloomFilter) {
+    bool old_enable = config::parquet_writer_bloom_filter_enable;
+    config::parquet_writer_bloom_filter_enable = true;
+    DeferOp defer([&]() { config::parquet_writer_bloom_filter_enable = old_enable; });
+
+    std::vector<TypeDescriptor> type_descs{
+            TypeDescriptor::from_logical_type(TYPE_INT),
+            TypeDescriptor::from_logical_type(TYPE_VARCHAR),
+    };
+    const int num_rows = 100;
+    auto chunk = std::make_shared<Chunk>();
+    {
+        auto col0 = ColumnHelper::create_column(type_descs[0], true);
+        auto col1 = ColumnHelper::create_column(type_descs[1], true);
+        for (int i = 0; i < num_rows; i++) {
+            col0->append_datum(Datum(i * 2));
+            std::string value = "v" + std::to_string(i * 2);
+            col1->append_datum(Datum(Slice(value)));
+        }
+        chunk->append_column(col0, chunk->num_columns());
+        chunk->append_column(col1, chunk->num_columns());
+    }
+
+    auto schema = _make_schema(type_descs);
+    ASSERT_TRUE(schema != nullptr);
+    ASSERT_OK(_write_chunk(chunk, type_descs, schema));
+
+    // the footer written again after bloom filters is still readable
+    auto read_chunk = _read_chunk(type_descs);
+    ASSERT_TRUE(read_chunk != nullptr);
+    Utils::assert_equal_chunk(chunk.get(), read_chunk.get());
+
+    ASSIGN_OR_ABORT(auto file, _fs.new_random_access_file(_file_path));
+    ASSIGN_OR_ABORT(auto file_size, _fs.get_file_size(_file_path));
+    // an odd value within [min, max] of c0 which is rejected by its bloom filter
+    int absent_value = -1;
+    {
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(), file_size, 0);
+        ASSERT_OK(file_reader->init(_create_scan_context(type_descs)));
+        const auto& row_group = file_reader->get_file_metadata()->t_metadata().row_groups[0];
+        ASSERT_TRUE(row_group.columns[0].meta_data.__isset.bloom_filter_offset);
+        ASSERT_TRUE(row_group.columns[1].meta_data.__isset.bloom_filter_offset);
+
+        ASSIGN_OR_ABORT(auto bf, ParquetBloomFilter::read(file.get(), file_size, row_group.columns[0].meta_data));
+        for (int i = 0; i < num_rows; i++) {
+            uint64_t hash = 0;
+            ASSERT_TRUE(ParquetBloomFilter::hash_datum(tparquet::Type::INT32, TYPE_INT, Datum(i * 2), &hash));
+            ASSERT_TRUE(bf->test_hash(hash));
+        }
+        for (int i = 1; i < num_rows * 2 && absent_value < 0; i += 2) {
+            uint64_t hash = 0;
+            ASSERT_TRUE(ParquetBloomFilter::hash_datum(tparquet::Type::INT32, TYPE_INT, Datum(i), &hash));
+            if (!bf->test_hash(hash)) {
+                absent_value = i;
+            }
+        }
+        ASSERT_GT(absent_value, 0);
+    }
+
+    // the row group is skipped by c0 = absent_value, but not by c0 = 2
+    for (int value : {absent_value, 2}) {
+        auto ctx = _create_scan_context(type_descs);
+        SlotId slot_id = ctx->tuple_desc->slots()[0]->id();
+        std::vector<TExpr> t_conjuncts;
+        ParquetUTBase::append_int_conjunct(TExprOpcode::EQ, slot_id, value, &t_conjuncts);
+        ParquetUTBase::create_conjunct_ctxs(&_pool, _runtime_state, &t_conjuncts, &ctx->conjunct_ctxs_by_slot[slot_id]);
+
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(), file_size, 0);
+        ASSERT_OK(file_reader->init(ctx));
+        ASSERT_EQ(value == absent_value ? 0 : 1, file_reader->_row_group_readers.size());
+    }
+}
+
+TEST_F(FileWriterTest, TestBloomFilterWithNullInSet) {
+    bool old_enable = config::parquet_writer_bloom_filter_enable;
+    config::parquet_writer_bloom_filter_enable = true;
+    DeferOp defer([&]() { config::parquet_writer_bloom_filter_enable = old_enable; });
+
+    std::vector<TypeDescriptor> type_descs{TypeDescriptor::from_logical_type(TYPE_INT)};
+    const int num_rows = 100;
+    auto chunk = std::make_shared<Chunk>();
+    {
+        auto col0 = ColumnHelper::create_column(type_descs[0], true);
+        for (int i = 0; i < num_rows; i++) {
+            col0->append_datum(Datum(i * 2));
+        }
+        // null values are not recorded by the bloom filter
+        col0->append_nulls(10);
+        chunk->append_column(col0, chunk->num_columns());
+    }
+    auto schema = _make_schema(type_descs);
+    ASSERT_TRUE(schema != nullptr);
+    ASSERT_OK(_write_chunk(chunk, type_descs, schema));
+
+    ASSIGN_OR_ABORT(auto file, _fs.new_random_access_file(_file_path));
+    ASSIGN_OR_ABORT(auto file_size, _fs.get_file_size(_file_path));
+    int absent_value = -1;
+    {
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(), file_size, 0);
+        ASSERT_OK(file_reader->init(_create_scan_context(type_descs)));
+        const auto& row_group = file_reader->get_file_metadata()->t_metadata().row_groups[0];
+        ASSIGN_OR_ABORT(auto bf, ParquetBloomFilter::read(file.get(), file_size, row_group.columns[0].meta_data));
+        for (int i = 1; i < num_rows * 2 && absent_value < 0; i += 2) {
+            uint64_t hash = 0;
+            ASSERT_TRUE(ParquetBloomFilter::hash_datum(tparquet::Type::INT32, TYPE_INT, Datum(i), &hash));
+            if (!bf->test_hash(hash)) {
+                absent_value = i;
+            }
+        }
+        ASSERT_GT(absent_value, 0);
+    }
+
+    // runtime in filter of (absent_value, NULL), null is only in the set of null safe equal join
+    for (bool eq_null : {false, true}) {
+        auto ctx = _create_scan_context(type_descs);
+        SlotDescriptor* slot = ctx->tuple_desc->slots()[0];
+        VectorizedInConstPredicateBuilder builder(_runtime_state, &_pool, _pool.add(new ColumnRef(slot)));
+        builder.set_eq_null(eq_null);
+        builder.use_as_join_runtime_filter();
+        ASSERT_OK(builder.create());
+        auto values = ColumnHelper::create_column(type_descs[0], true);
+        values->append_datum(Datum(absent_value));
+        values->append_nulls(1);
+        builder.add_values(values, 0);
+        ExprContext* in_ctx = builder.get_in_const_predicate();
+        ASSERT_OK(in_ctx->prepare(_runtime_state));
+        ASSERT_OK(in_ctx->open(_runtime_state));
+        ctx->conjunct_ctxs_by_slot[slot->id()].push_back(in_ctx);
+
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(), file_size, 0);
+        ASSERT_OK(file_reader->init(ctx));
+        // the row group holds null values, which match the filter with null in set
+        ASSERT_EQ(eq_null ? 1 : 0, file_reader->_row_group_readers.size());
+        in_ctx->close(_runtime_state);
+    }
+}
+
 TEST_F(FileWriterTest, TestFieldIdWithStruct) {
     std::vector<TypeDescriptor> type_descs;
     auto type_int_struct = TypeDescriptor::from_logical_type(TYPE_STRUCT);
@@ -276,4 +276,34 @@ TEST_F(PosixFileSystemTest, test_delete_files) {
     EXPECT_OK(fs->delete_dir_recursive(path2));
 }
 
+TEST_F(PosixFileSystemTest, test_clone_file) {
+    auto fs = FileSystem::Default();
+
+    auto src = std::string("./ut_dir/fs_posix/clone_src");
+    auto dst = std::string("./ut_dir/fs_posix/clone_dst");
+    ASSIGN_OR_ABORT(auto wf, fs->new_writable_file(src));
+    EXPECT_OK(wf->append("hello"));
+    EXPECT_OK(wf->close());
+
+    auto st = fs::clone_file(src, dst);
+    if (st.is_not_supported()) {
+        // the file system of the test directory cannot clone files, nothing is left behind
+        EXPECT_TRUE(fs->path_exists(dst).is_not_found());
+        return;
+    }
+    ASSERT_OK(st);
+    // appending to the clone leaves the source unchanged
+    WritableFileOptions opts{.sync_on_close = false, .mode = FileSystem::MUST_EXIST};
+    ASSIGN_OR_ABORT(auto clone, fs->new_writable_file(opts, dst));
+    EXPECT_EQ(5, clone->size());
+    EXPECT_OK(clone->append(" world!"));
+    EXPECT_OK(clone->close());
+    ASSIGN_OR_ABORT(auto src_file, fs->new_random_access_file(src));
+    ASSIGN_OR_ABORT(auto dst_file, fs->new_random_access_file(dst));
+    ASSIGN_OR_ABORT(auto src_content, src_file->read_all());
+    ASSIGN_OR_ABORT(auto dst_content, dst_file->read_all());
+    EXPECT_EQ("hello", src_content);
+    EXPECT_EQ("hello world!", dst_content);
+}
+
 } // namespace starrocks
@@ -16,9 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 #include "block_cache/block_cache.h"
 #include "fs/fs_util.h"
 #include "testutil/assert.h"
+#include "util/priority_thread_pool.hpp"
 
 namespace starrocks::io {
 
@@ -48,6 +52,17 @@ private:
     int64_t _offset{0};
 };
 
+// Reads slowly, so that a prefetch is still running when the data is read.
+class SlowSeekableInputStream : public MockSeekableInputStream {
+public:
+    using MockSeekableInputStream::MockSeekableInputStream;
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        return MockSeekableInputStream::read_at_fully(offset, out, count);
+    }
+};
+
 class CacheInputStreamTest : public ::testing::Test {
 public:
     static void SetUpTestCase() {
@@ -296,4 +311,43 @@ TEST_F(CacheInputStreamTest, test_read_with_zero_range) {
     ASSERT_EQ(stats.read_cache_count, 0);
 }
 
+TEST_F(CacheInputStreamTest, test_read_from_prefetching_io_buffer) {
+    int64_t data_size = block_size;
+    std::string data(data_size, 0);
+    gen_test_data(data.data(), data_size, block_size);
+
+    const std::string file_name = "test_file5";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data.data(), data_size));
+    auto prefetch_stream = std::make_shared<SlowSeekableInputStream>(data.data(), data_size);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(stream, file_name, data_size);
+    sb_stream->set_prefetch_stream_opener([&]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+        return std::static_pointer_cast<io::SeekableInputStream>(prefetch_stream);
+    });
+    io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000);
+    cache_stream.set_enable_populate_cache(true);
+    cache_stream.set_enable_block_buffer(true);
+    sb_stream->set_align_size(cache_stream.get_align_size());
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    ranges.emplace_back(0, data_size);
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+
+    // the buffer is reserved by the prefetch, which is still reading into it
+    PriorityThreadPool executor("prefetch", 1, 16);
+    sb_stream->prefetch(&executor, ranges);
+    std::string buffer(1024, 0);
+    read_stream_data(&cache_stream, 0, buffer.size(), buffer.data());
+    ASSERT_TRUE(check_data_content(buffer.data(), buffer.size(), 'a'));
+    executor.drain_and_shutdown();
+
+    // the populated cache holds the file data rather than the uninitialized buffer
+    std::shared_ptr<io::SeekableInputStream> empty_stream(new MockSeekableInputStream(nullptr, data_size));
+    auto empty_sb_stream = std::make_shared<io::SharedBufferedInputStream>(empty_stream, file_name, data_size);
+    io::CacheInputStream cached_stream(empty_sb_stream, file_name, data_size, 1000);
+    cached_stream.set_enable_block_buffer(false);
+    std::string cached(data_size, 0);
+    read_stream_data(&cached_stream, 0, data_size, cached.data());
+    ASSERT_EQ(1, cached_stream.stats().read_cache_count);
+    ASSERT_TRUE(check_data_content(cached.data(), data_size, 'a'));
+}
+
 } // namespace starrocks::io
@@ -16,9 +16,12 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+
 #include "io_test_base.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
+#include "util/priority_thread_pool.hpp"
 
 namespace starrocks::io {
 
@@ -179,4 +182,127 @@ TEST_F(SharedBufferedInputStreamTest, test_orc) {
             sb.value()->debug_string());
 }
 
-} // namespace starrocks::io
\ No newline at end of file
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_max_skip_ratio) {
+    size_t len = 4 * 1024 * 1024;
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<TestInputStream>(rand_string, len);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    io::SharedBufferedInputStream::CoalesceOptions options;
+    options.max_skip_ratio = 1.0;
+    sb_stream->set_coalesce_options(options);
+
+    // pages selected by page index
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    // small gap, always coalesced
+    ranges.emplace_back(0, 64 * 1024);
+    ranges.emplace_back(100 * 1024, 64 * 1024);
+    // 300k gap is larger than 192k requested bytes, not coalesced
+    ranges.emplace_back(464 * 1024, 256 * 1024);
+    // 200k gap is not larger than 320k requested bytes, coalesced
+    ranges.emplace_back(920 * 1024, 64 * 1024);
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+
+    ASSIGN_OR_ABORT(auto sb, sb_stream->find_shared_buffer(100 * 1024, 64 * 1024));
+    ASSERT_EQ(0, sb->raw_offset);
+    ASSERT_EQ(164 * 1024, sb->raw_size);
+    ASSIGN_OR_ABORT(sb, sb_stream->find_shared_buffer(920 * 1024, 64 * 1024));
+    ASSERT_EQ(464 * 1024, sb->raw_offset);
+    ASSERT_EQ(520 * 1024, sb->raw_size);
+}
+
+class CountedTestInputStream : public TestInputStream {
+public:
+    using TestInputStream::TestInputStream;
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override {
+        _read_count += 1;
+        return TestInputStream::read_at_fully(offset, out, count);
+    }
+
+    int64_t read_count() const { return _read_count; }
+
+private:
+    std::atomic<int64_t> _read_count = 0;
+};
+
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_prefetch) {
+    size_t len = 4 * 1024 * 1024;
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<CountedTestInputStream>(rand_string, len);
+    auto prefetch_in = std::make_shared<CountedTestInputStream>(rand_string, len);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    io::SharedBufferedInputStream::CoalesceOptions options;
+    options.max_dist_size = 64 * 1024;
+    sb_stream->set_coalesce_options(options);
+    sb_stream->set_prefetch_stream_opener([&]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+        return std::static_pointer_cast<io::SeekableInputStream>(prefetch_in);
+    });
+
+    std::vector<io::SharedBufferedInputStream::IORange> cur_ranges;
+    cur_ranges.emplace_back(0, 100 * 1024);
+    ASSERT_OK(sb_stream->set_io_ranges(cur_ranges, false));
+    std::vector<io::SharedBufferedInputStream::IORange> next_ranges;
+    next_ranges.emplace_back(1024 * 1024, 100 * 1024, false);
+    next_ranges.emplace_back(2 * 1024 * 1024, 100 * 1024);
+    next_ranges.emplace_back(3 * 1024 * 1024, 100 * 1024);
+    ASSERT_OK(sb_stream->set_io_ranges(next_ranges, false));
+
+    PriorityThreadPool executor("prefetch", 1, 16);
+    // only the buffers of the active ranges are prefetched
+    sb_stream->prefetch(&executor, next_ranges);
+    executor.drain_and_shutdown();
+    ASSERT_EQ(2, prefetch_in->read_count());
+    ASSERT_EQ(0, in->read_count());
+
+    std::string buf(100 * 1024, 0);
+    ASSERT_OK(sb_stream->read_at_fully(0, buf.data(), buf.size()));
+    ASSERT_EQ(rand_string.substr(0, buf.size()), buf);
+    for (const auto& r : next_ranges) {
+        ASSERT_OK(sb_stream->read_at_fully(r.offset, buf.data(), r.size));
+        ASSERT_EQ(rand_string.substr(r.offset, r.size), buf);
+    }
+    // the active ranges of the next group are served from the prefetched buffers,
+    // the current group and the lazy range are read by the caller
+    ASSERT_EQ(4, sb_stream->shared_io_count());
+    ASSERT_EQ(2, sb_stream->prefetch_io_count());
+    ASSERT_EQ(2, in->read_count());
+    ASSERT_EQ(2, prefetch_in->read_count());
+}
+
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_release_range) {
+    size_t len = 4 * 1024 * 1024;
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<CountedTestInputStream>(rand_string, len);
+    auto prefetch_in = std::make_shared<CountedTestInputStream>(rand_string, len);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    sb_stream->set_prefetch_stream_opener([&]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+        return std::static_pointer_cast<io::SeekableInputStream>(prefetch_in);
+    });
+
+    std::vector<io::SharedBufferedInputStream::IORange> cur_ranges;
+    cur_ranges.emplace_back(0, 100 * 1024);
+    ASSERT_OK(sb_stream->set_io_ranges(cur_ranges));
+    std::vector<io::SharedBufferedInputStream::IORange> next_ranges;
+    next_ranges.emplace_back(2 * 1024 * 1024, 100 * 1024);
+    ASSERT_OK(sb_stream->set_io_ranges(next_ranges));
+
+    PriorityThreadPool executor("prefetch", 1, 16);
+    sb_stream->prefetch(&executor, next_ranges);
+    // waits for the prefetch of the next group and drops it, the current group is kept
+    sb_stream->release_range(2 * 1024 * 1024, 2 * 1024 * 1024 + 100 * 1024);
+    ASSERT_OK(sb_stream->find_shared_buffer(0, 100 * 1024).status());
+    ASSERT_FALSE(sb_stream->find_shared_buffer(2 * 1024 * 1024, 100 * 1024).ok());
+
+    // register it again in another mode
+    next_ranges.emplace_back(2 * 1024 * 1024 + 200 * 1024, 100 * 1024, false);
+    ASSERT_OK(sb_stream->set_io_ranges(next_ranges, false));
+    std::string buf(100 * 1024, 0);
+    for (const auto& r : next_ranges) {
+        ASSERT_OK(sb_stream->read_at_fully(r.offset, buf.data(), r.size));
+        ASSERT_EQ(rand_string.substr(r.offset, r.size), buf);
+    }
+    ASSERT_EQ(2, in->read_count());
+    executor.drain_and_shutdown();
+}
+
+} // namespace starrocks::io
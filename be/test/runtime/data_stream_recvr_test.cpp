@@ -0,0 +1,551 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/data_stream_recvr.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "exec/pipeline/exchange/exchange_sink_operator.h"
+#include "exec/pipeline/exchange/sink_buffer.h"
+#include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/query_context.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "gen_cpp/internal_service.pb.h"
+#include "gutil/casts.h"
+#include "runtime/data_stream_mgr.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/exec_env.h"
+#include "runtime/local_pass_through_buffer.h"
+#include "runtime/runtime_state.h"
+#include "service/backend_options.h"
+#include "testutil/assert.h"
+#include "util/await.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+class DataStreamRecvrTest : public ::testing::Test {
+public:
+    void SetUp() override;
+    void TearDown() override;
+
+protected:
+    static constexpr PlanNodeId kDestNodeId = 1;
+    static constexpr SlotId kIntSlotId = 0;
+    static constexpr SlotId kStringSlotId = 1;
+
+    // Prepare the query and fragment contexts and the row descriptor of the exchanged chunks.
+    void _prepare(TCompressionType::type compression_type);
+
+    // Create a sink operator without channels, which is only used to serialize chunks.
+    pipeline::ExchangeSinkOperator* _create_sink();
+
+    // Create a sink operator which shuffles chunks by the int column to the receiver in the same process
+    // through pass through, each driver sequence of the receiver gets a shuffle.
+    pipeline::ExchangeSinkOperator* _create_pass_through_shuffle_sink(int32_t num_shuffles);
+
+    pipeline::ExchangeSinkOperator* _create_sink(TPartitionType::type part_type,
+                                                 const std::vector<TPlanFragmentDestination>& destinations,
+                                                 const std::vector<ExprContext*>& partition_expr_ctxs,
+                                                 int32_t num_shuffles_per_channel, bool enable_pass_through);
+
+    std::shared_ptr<DataStreamRecvr> _create_recvr(int num_senders, int32_t dop = 1);
+
+    // A chunk with a not null int column and a nullable varchar column, whose rows are generated from
+    // the values in [start, start + num_rows).
+    static ChunkUniquePtr _create_chunk(int32_t start, size_t num_rows);
+
+    // Serialize |chunks| into one request and transmit it to the receiver the way the brpc service does,
+    // i.e. the data of the chunks is cut from the attachment.
+    void _transmit(pipeline::ExchangeSinkOperator* sink, const std::vector<ChunkUniquePtr>& chunks,
+                   bool* is_first_chunk, int64_t sequence, bool eos,
+                   CompressionTypePB expected_compress_type = CompressionTypePB::NO_COMPRESSION);
+
+    // Transmit |chunks| through the pass through buffer, the receiver gets them with the columns unchanged.
+    void _transmit_pass_through(const std::vector<ChunkUniquePtr>& chunks, int64_t sequence, bool eos);
+
+    // Transmit chunks with |rows_per_chunk| rows in one serialized request with eos.
+    void _transmit_chunks_of(const std::vector<int32_t>& rows_per_chunk);
+
+    ChunkUniquePtr _fetch_chunk(int32_t driver_sequence = 0);
+
+    // Drain the receiver and return the rows of the fetched chunks.
+    static std::vector<std::string> _drain(DataStreamRecvr* recvr);
+
+    static std::vector<std::string> _rows_of(const std::vector<ChunkUniquePtr>& chunks);
+
+    void _test_round_trip(TCompressionType::type compression_type, CompressionTypePB expected_compress_type);
+
+    int _chunk_size = 4096;
+    TExecPlanFragmentParams _request;
+    ExecEnv* _exec_env = nullptr;
+    pipeline::QueryContext* _query_ctx = nullptr;
+    pipeline::FragmentContext* _fragment_ctx = nullptr;
+    RuntimeState* _runtime_state = nullptr;
+    RowDescriptor* _row_desc = nullptr;
+    ObjectPool _pool;
+
+    std::shared_ptr<pipeline::SinkBuffer> _sink_buffer;
+    std::unique_ptr<pipeline::ExchangeSinkOperatorFactory> _sink_factory;
+    pipeline::OperatorPtr _sink;
+    std::shared_ptr<DataStreamRecvr> _recvr;
+};
+
+void DataStreamRecvrTest::SetUp() {
+    static std::atomic<int64_t> s_next_id{1};
+    int64_t id = s_next_id++;
+    _request.params.query_id.hi = 20240101;
+    _request.params.query_id.lo = id;
+    _request.params.fragment_instance_id.hi = 20240101;
+    _request.params.fragment_instance_id.lo = id;
+    _exec_env = ExecEnv::GetInstance();
+    _exec_env->stream_mgr()->prepare_pass_through_chunk_buffer(_request.params.query_id);
+}
+
+void DataStreamRecvrTest::TearDown() {
+    if (_recvr != nullptr) {
+        _recvr->close();
+        _recvr.reset();
+    }
+    if (_sink != nullptr) {
+        _sink->close(_runtime_state);
+        _sink.reset();
+    }
+    if (_sink_factory != nullptr) {
+        _sink_factory->close(_runtime_state);
+        _sink_factory.reset();
+    }
+    _sink_buffer.reset();
+    _exec_env->stream_mgr()->destroy_pass_through_chunk_buffer(_request.params.query_id);
+}
+
+void DataStreamRecvrTest::_prepare(TCompressionType::type compression_type) {
+    _request.query_options.__set_transmission_compression_type(compression_type);
+    _request.query_options.__set_transmission_encode_level(0);
+    _request.query_options.__set_query_timeout(60);
+
+    const auto& query_id = _request.params.query_id;
+    const auto& fragment_id = _request.params.fragment_instance_id;
+
+    _query_ctx = _exec_env->query_context_mgr()->get_or_register(query_id);
+    _query_ctx->set_total_fragments(1);
+    _query_ctx->set_delivery_expire_seconds(60);
+    _query_ctx->set_query_expire_seconds(60);
+    _query_ctx->extend_delivery_lifetime();
+    _query_ctx->extend_query_lifetime();
+    _query_ctx->init_mem_tracker(GlobalEnv::GetInstance()->query_pool_mem_tracker()->limit(),
+                                 GlobalEnv::GetInstance()->query_pool_mem_tracker());
+
+    _fragment_ctx = _query_ctx->fragment_mgr()->get_or_register(fragment_id);
+    _fragment_ctx->set_query_id(query_id);
+    _fragment_ctx->set_fragment_instance_id(fragment_id);
+    _fragment_ctx->set_runtime_state(std::make_unique<RuntimeState>(
+            query_id, fragment_id, _request.query_options, _request.query_globals, _exec_env));
+
+    _runtime_state = _fragment_ctx->runtime_state();
+    _runtime_state->set_chunk_size(_chunk_size);
+    _runtime_state->init_mem_trackers(_query_ctx->mem_tracker());
+    _runtime_state->set_query_ctx(_query_ctx);
+    _runtime_state->set_fragment_ctx(_fragment_ctx);
+
+    TDescriptorTableBuilder table_desc_builder;
+    TTupleDescriptorBuilder tuple_desc_builder;
+    tuple_desc_builder.add_slot(
+            TSlotDescriptorBuilder().type(TYPE_INT).column_name("c0").id(kIntSlotId).nullable(false).build());
+    tuple_desc_builder.add_slot(
+            TSlotDescriptorBuilder().string_type(64).column_name("c1").id(kStringSlotId).nullable(true).build());
+    tuple_desc_builder.build(&table_desc_builder);
+    DescriptorTbl* tbl = nullptr;
+    ASSERT_OK(DescriptorTbl::create(_runtime_state, &_pool, table_desc_builder.desc_tbl(), &tbl,
+                                    _runtime_state->chunk_size()));
+    _row_desc = _pool.add(new RowDescriptor(*tbl, std::vector<TTupleId>{0}, std::vector<bool>{false}));
+}
+
+pipeline::ExchangeSinkOperator* DataStreamRecvrTest::_create_sink() {
+    return _create_sink(TPartitionType::UNPARTITIONED, {}, {}, 1, false);
+}
+
+pipeline::ExchangeSinkOperator* DataStreamRecvrTest::_create_pass_through_shuffle_sink(int32_t num_shuffles) {
+    TPlanFragmentDestination destination;
+    destination.__set_fragment_instance_id(_request.params.fragment_instance_id);
+    TNetworkAddress brpc_server;
+    brpc_server.__set_hostname(BackendOptions::get_localhost());
+    brpc_server.__set_port(config::brpc_port);
+    destination.__set_brpc_server(brpc_server);
+
+    auto* partition_expr = _pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), kIntSlotId));
+    std::vector<ExprContext*> partition_expr_ctxs{_pool.add(new ExprContext(partition_expr))};
+    return _create_sink(TPartitionType::HASH_PARTITIONED, {destination}, partition_expr_ctxs, num_shuffles, true);
+}
+
+pipeline::ExchangeSinkOperator* DataStreamRecvrTest::_create_sink(
+        TPartitionType::type part_type, const std::vector<TPlanFragmentDestination>& destinations,
+        const std::vector<ExprContext*>& partition_expr_ctxs, int32_t num_shuffles_per_channel,
+        bool enable_pass_through) {
+    _sink_buffer = std::make_shared<pipeline::SinkBuffer>(_fragment_ctx, destinations, false);
+    _sink_factory = std::make_unique<pipeline::ExchangeSinkOperatorFactory>(
+            1, kDestNodeId, _sink_buffer, part_type, destinations, num_shuffles_per_channel > 1,
+            num_shuffles_per_channel, 0, kDestNodeId, partition_expr_ctxs, enable_pass_through, false, _fragment_ctx,
+            std::vector<int32_t>{});
+    CHECK_OK(_sink_factory->prepare(_runtime_state));
+    _sink = _sink_factory->create(1, 0);
+    CHECK_OK(_sink->prepare(_runtime_state));
+    return down_cast<pipeline::ExchangeSinkOperator*>(_sink.get());
+}
+
+std::shared_ptr<DataStreamRecvr> DataStreamRecvrTest::_create_recvr(int num_senders, int32_t dop) {
+    auto recvr = _exec_env->stream_mgr()->create_recvr(_runtime_state, *_row_desc,
+                                                       _request.params.fragment_instance_id, kDestNodeId, num_senders,
+                                                       config::exchg_node_buffer_size_bytes, false, nullptr, true, dop,
+                                                       false);
+    for (int32_t i = 0; i < dop; i++) {
+        recvr->bind_profile(i, std::make_shared<RuntimeProfile>("DataStreamRecvrTest"));
+    }
+    return recvr;
+}
+
+ChunkUniquePtr DataStreamRecvrTest::_create_chunk(int32_t start, size_t num_rows) {
+    auto int_column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+    auto string_column = ColumnHelper::create_column(TypeDescriptor::create_varchar_type(64), true);
+    for (int32_t i = start; i < start + static_cast<int32_t>(num_rows); i++) {
+        // runs of equal values, so the data is compressible
+        int_column->append_datum(Datum(i / 64));
+        if (i % 7 == 0) {
+            string_column->append_nulls(1);
+        } else {
+            std::string value = "value_" + std::to_string(i % 100);
+            string_column->append_datum(Datum(Slice(value)));
+        }
+    }
+    auto chunk = std::make_unique<Chunk>();
+    chunk->append_column(std::move(int_column), kIntSlotId);
+    chunk->append_column(std::move(string_column), kStringSlotId);
+    return chunk;
+}
+
+void DataStreamRecvrTest::_transmit(pipeline::ExchangeSinkOperator* sink, const std::vector<ChunkUniquePtr>& chunks,
+                                    bool* is_first_chunk, int64_t sequence, bool eos,
+                                    CompressionTypePB expected_compress_type) {
+    PTransmitChunkParams request;
+    pipeline::ExchangeSinkOperator::RequestAttachment attachment;
+    size_t num_compressed = 0;
+    for (const auto& chunk : chunks) {
+        auto* pchunk = request.add_chunks();
+        ASSERT_OK(sink->serialize_chunk(chunk.get(), pchunk, is_first_chunk, 1, nullptr, &attachment));
+        ASSERT_TRUE(pchunk->data().empty());
+        // a small chunk may be sent uncompressed if its compress ratio is too low
+        if (pchunk->compress_type() != CompressionTypePB::NO_COMPRESSION) {
+            ASSERT_EQ(expected_compress_type, pchunk->compress_type());
+            num_compressed++;
+        }
+    }
+    ASSERT_EQ(expected_compress_type != CompressionTypePB::NO_COMPRESSION, num_compressed > 0);
+    butil::IOBuf io_buf;
+    attachment.release(&io_buf);
+
+    for (int i = 0; i < request.chunks_size(); i++) {
+        auto* pchunk = request.mutable_chunks(i);
+        ASSERT_EQ(pchunk->data_size(), io_buf.cutn(pchunk->mutable_data(), pchunk->data_size()));
+    }
+    ASSERT_TRUE(io_buf.empty());
+
+    request.mutable_finst_id()->set_hi(_request.params.fragment_instance_id.hi);
+    request.mutable_finst_id()->set_lo(_request.params.fragment_instance_id.lo);
+    request.set_node_id(kDestNodeId);
+    request.set_sender_id(0);
+    request.set_be_number(0);
+    request.set_sequence(sequence);
+    request.set_eos(eos);
+    ASSERT_OK(_exec_env->stream_mgr()->transmit_chunk(request, nullptr));
+}
+
+void DataStreamRecvrTest::_transmit_pass_through(const std::vector<ChunkUniquePtr>& chunks, int64_t sequence,
+                                                 bool eos) {
+    PassThroughContext context(_exec_env->stream_mgr()->get_pass_through_chunk_buffer(_request.params.query_id),
+                               _request.params.fragment_instance_id, kDestNodeId);
+    context.init();
+    for (const auto& chunk : chunks) {
+        context.append_chunk(0, chunk.get(), chunk->memory_usage(), 0);
+    }
+
+    PTransmitChunkParams request;
+    request.mutable_finst_id()->set_hi(_request.params.fragment_instance_id.hi);
+    request.mutable_finst_id()->set_lo(_request.params.fragment_instance_id.lo);
+    request.set_node_id(kDestNodeId);
+    request.set_sender_id(0);
+    request.set_be_number(0);
+    request.set_sequence(sequence);
+    request.set_eos(eos);
+    request.set_use_pass_through(true);
+    ASSERT_OK(_exec_env->stream_mgr()->transmit_chunk(request, nullptr));
+}
+
+void DataStreamRecvrTest::_transmit_chunks_of(const std::vector<int32_t>& rows_per_chunk) {
+    auto* sink = _create_sink();
+    std::vector<ChunkUniquePtr> chunks;
+    int32_t start = 0;
+    for (int32_t num_rows : rows_per_chunk) {
+        chunks.emplace_back(_create_chunk(start, num_rows));
+        start += num_rows;
+    }
+    bool is_first_chunk = true;
+    _transmit(sink, chunks, &is_first_chunk, 0, true);
+}
+
+ChunkUniquePtr DataStreamRecvrTest::_fetch_chunk(int32_t driver_sequence) {
+    std::unique_ptr<Chunk> chunk;
+    CHECK_OK(_recvr->get_chunk_for_pipeline(&chunk, driver_sequence));
+    return chunk;
+}
+
+std::vector<std::string> DataStreamRecvrTest::_drain(DataStreamRecvr* recvr) {
+    std::vector<std::string> rows;
+    while (true) {
+        std::unique_ptr<Chunk> chunk;
+        CHECK_OK(recvr->get_chunk_for_pipeline(&chunk, 0));
+        if (chunk == nullptr) {
+            break;
+        }
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            rows.emplace_back(chunk->debug_row(i));
+        }
+    }
+    return rows;
+}
+
+std::vector<std::string> DataStreamRecvrTest::_rows_of(const std::vector<ChunkUniquePtr>& chunks) {
+    std::vector<std::string> rows;
+    for (const auto& chunk : chunks) {
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            rows.emplace_back(chunk->debug_row(i));
+        }
+    }
+    return rows;
+}
+
+void DataStreamRecvrTest::_test_round_trip(TCompressionType::type compression_type,
+                                           CompressionTypePB expected_compress_type) {
+    _prepare(compression_type);
+    auto* sink = _create_sink();
+    _recvr = _create_recvr(1);
+
+    std::vector<std::string> expected_rows;
+    bool is_first_chunk = true;
+    int32_t start = 0;
+    constexpr int kNumRequests = 3;
+    for (int seq = 0; seq < kNumRequests; seq++) {
+        // several chunks of different sizes in one request
+        std::vector<ChunkUniquePtr> chunks;
+        for (int32_t num_rows : {1000, 17, 4096}) {
+            chunks.emplace_back(_create_chunk(start, num_rows));
+            start += num_rows;
+        }
+        _transmit(sink, chunks, &is_first_chunk, seq, seq == kNumRequests - 1, expected_compress_type);
+        auto rows = _rows_of(chunks);
+        expected_rows.insert(expected_rows.end(), rows.begin(), rows.end());
+    }
+
+    ASSERT_EQ(expected_rows, _drain(_recvr.get()));
+    ASSERT_TRUE(_recvr->is_finished());
+}
+
+TEST_F(DataStreamRecvrTest, test_round_trip_without_compression) {
+    _test_round_trip(TCompressionType::NO_COMPRESSION, CompressionTypePB::NO_COMPRESSION);
+}
+
+// Every chunk is compressed straight into the attachment.
+TEST_F(DataStreamRecvrTest, test_round_trip_compressed_to_attachment) {
+    int64_t old_min_bytes = config::exchange_zero_copy_compression_min_bytes;
+    DeferOp defer([&]() { config::exchange_zero_copy_compression_min_bytes = old_min_bytes; });
+    config::exchange_zero_copy_compression_min_bytes = 0;
+    _test_round_trip(TCompressionType::LZ4, CompressionTypePB::LZ4);
+}
+
+// Every chunk is compressed into the scratch buffer, and then copied to the attachment.
+TEST_F(DataStreamRecvrTest, test_round_trip_compressed_by_copy) {
+    int64_t old_min_bytes = config::exchange_zero_copy_compression_min_bytes;
+    DeferOp defer([&]() { config::exchange_zero_copy_compression_min_bytes = old_min_bytes; });
+    config::exchange_zero_copy_compression_min_bytes = std::numeric_limits<int64_t>::max();
+    _test_round_trip(TCompressionType::LZ4, CompressionTypePB::LZ4);
+}
+
+// Small chunks go through the scratch buffer and large ones are compressed straight into the attachment,
+// and both are cut from the same attachment.
+TEST_F(DataStreamRecvrTest, test_round_trip_compressed_mixed) {
+    int64_t old_min_bytes = config::exchange_zero_copy_compression_min_bytes;
+    DeferOp defer([&]() { config::exchange_zero_copy_compression_min_bytes = old_min_bytes; });
+    // the serialized 17 rows chunk is below the threshold, and the others are above it.
+    config::exchange_zero_copy_compression_min_bytes = 4096;
+    _test_round_trip(TCompressionType::LZ4, CompressionTypePB::LZ4);
+}
+
+// Small chunks are merged until the next one doesn't fit in the chunk size.
+TEST_F(DataStreamRecvrTest, test_coalesce_small_chunks) {
+    bool old_coalesce = config::enable_exchange_receiver_coalesce_chunks;
+    DeferOp defer([&]() { config::enable_exchange_receiver_coalesce_chunks = old_coalesce; });
+    config::enable_exchange_receiver_coalesce_chunks = true;
+
+    _chunk_size = 100;
+    _prepare(TCompressionType::NO_COMPRESSION);
+    _recvr = _create_recvr(1);
+    _transmit_chunks_of({10, 20, 30, 40});
+
+    auto chunk = _fetch_chunk();
+    ASSERT_NE(nullptr, chunk);
+    ASSERT_EQ(100, chunk->num_rows());
+    for (size_t i = 0; i < chunk->num_rows(); i++) {
+        ASSERT_EQ(static_cast<int32_t>(i / 64), chunk->get_column_by_slot_id(kIntSlotId)->get(i).get_int32());
+    }
+    ASSERT_EQ(nullptr, _fetch_chunk());
+    ASSERT_TRUE(_recvr->is_finished());
+}
+
+// The chunk which doesn't fit is kept pending and returned by the next fetch, which coalesces it too.
+TEST_F(DataStreamRecvrTest, test_coalesce_pending_chunk) {
+    bool old_coalesce = config::enable_exchange_receiver_coalesce_chunks;
+    DeferOp defer([&]() { config::enable_exchange_receiver_coalesce_chunks = old_coalesce; });
+    config::enable_exchange_receiver_coalesce_chunks = true;
+
+    _chunk_size = 100;
+    _prepare(TCompressionType::NO_COMPRESSION);
+    _recvr = _create_recvr(1);
+    _transmit_chunks_of({40, 30, 45, 20});
+
+    auto chunk = _fetch_chunk();
+    ASSERT_NE(nullptr, chunk);
+    ASSERT_EQ(70, chunk->num_rows());
+
+    // all the senders are done, but the pending chunk is not fetched yet
+    ASSERT_TRUE(_recvr->has_output_for_pipeline(0));
+    ASSERT_FALSE(_recvr->is_finished());
+
+    chunk = _fetch_chunk();
+    ASSERT_NE(nullptr, chunk);
+    ASSERT_EQ(65, chunk->num_rows());
+    ASSERT_EQ(70 / 64, chunk->get_column_by_slot_id(kIntSlotId)->get(0).get_int32());
+
+    ASSERT_FALSE(_recvr->has_output_for_pipeline(0));
+    ASSERT_TRUE(_recvr->is_finished());
+    ASSERT_EQ(nullptr, _fetch_chunk());
+}
+
+// Chunks from pass through keep the columns of the sender, only the ones with the same layout are merged.
+TEST_F(DataStreamRecvrTest, test_coalesce_layout_mismatch) {
+    bool old_coalesce = config::enable_exchange_receiver_coalesce_chunks;
+    DeferOp defer([&]() { config::enable_exchange_receiver_coalesce_chunks = old_coalesce; });
+    config::enable_exchange_receiver_coalesce_chunks = true;
+
+    _chunk_size = 100;
+    _prepare(TCompressionType::NO_COMPRESSION);
+    _recvr = _create_recvr(1);
+
+    std::vector<ChunkUniquePtr> chunks;
+    chunks.emplace_back(_create_chunk(0, 10));
+    // nullable int column
+    chunks.emplace_back(_create_chunk(10, 10));
+    auto& int_column = chunks.back()->get_column_by_slot_id(kIntSlotId);
+    int_column = NullableColumn::create(int_column, NullColumn::create(int_column->size(), 0));
+    // const int column
+    chunks.emplace_back(_create_chunk(20, 10));
+    chunks.back()->get_column_by_slot_id(kIntSlotId) = ColumnHelper::create_const_column<TYPE_INT>(0, 10);
+    chunks.emplace_back(_create_chunk(30, 10));
+    chunks.emplace_back(_create_chunk(40, 10));
+    _transmit_pass_through(chunks, 0, true);
+
+    std::vector<size_t> num_rows;
+    while (auto chunk = _fetch_chunk()) {
+        num_rows.emplace_back(chunk->num_rows());
+    }
+    // only the last two chunks with the same layout are merged
+    ASSERT_EQ(std::vector<size_t>({10, 10, 10, 20}), num_rows);
+    ASSERT_TRUE(_recvr->is_finished());
+}
+
+// Short circuit drops the pending chunk, so the receiver is finished.
+TEST_F(DataStreamRecvrTest, test_coalesce_short_circuit) {
+    bool old_coalesce = config::enable_exchange_receiver_coalesce_chunks;
+    DeferOp defer([&]() { config::enable_exchange_receiver_coalesce_chunks = old_coalesce; });
+    config::enable_exchange_receiver_coalesce_chunks = true;
+
+    _chunk_size = 100;
+    _prepare(TCompressionType::NO_COMPRESSION);
+    _recvr = _create_recvr(1);
+    _transmit_chunks_of({40, 30, 45});
+
+    auto chunk = _fetch_chunk();
+    ASSERT_NE(nullptr, chunk);
+    ASSERT_EQ(70, chunk->num_rows());
+    ASSERT_FALSE(_recvr->is_finished());
+
+    _recvr->short_circuit_for_pipeline(0);
+    ASSERT_FALSE(_recvr->has_output_for_pipeline(0));
+    ASSERT_TRUE(_recvr->is_finished());
+    ASSERT_EQ(nullptr, _fetch_chunk());
+}
+
+// Full shuffled chunks are moved into the pass through buffer, and the requests notifying the receiver are
+// delivered in process, the receiver gets all the rows unchanged.
+TEST_F(DataStreamRecvrTest, test_pass_through_handover) {
+    bool old_bypass_brpc = config::enable_exchange_pass_through_bypass_brpc;
+    std::string old_localhost = BackendOptions::get_localhost();
+    DeferOp defer([&]() {
+        config::enable_exchange_pass_through_bypass_brpc = old_bypass_brpc;
+        BackendOptions::set_localhost(old_localhost);
+    });
+    config::enable_exchange_pass_through_bypass_brpc = true;
+    if (old_localhost.empty()) {
+        BackendOptions::set_localhost("127.0.0.1");
+    }
+
+    constexpr int32_t kNumShuffles = 2;
+    _chunk_size = 100;
+    _prepare(TCompressionType::NO_COMPRESSION);
+    _recvr = _create_recvr(1, kNumShuffles);
+    auto* sink = _create_pass_through_shuffle_sink(kNumShuffles);
+
+    std::vector<ChunkUniquePtr> chunks;
+    for (int32_t start = 0; start < 1000; start += _chunk_size) {
+        chunks.emplace_back(_create_chunk(start, _chunk_size));
+        ASSERT_OK(sink->push_chunk(_runtime_state, _create_chunk(start, _chunk_size)));
+    }
+    ASSERT_OK(sink->set_finishing(_runtime_state));
+    Awaitility await;
+    ASSERT_TRUE(await.timeout(5 * 1000 * 1000).until([&] { return _sink_buffer->is_finished(); }));
+
+    std::vector<std::string> rows;
+    for (int32_t driver_sequence = 0; driver_sequence < kNumShuffles; driver_sequence++) {
+        while (auto chunk = _fetch_chunk(driver_sequence)) {
+            ASSERT_LE(chunk->num_rows(), static_cast<size_t>(_chunk_size));
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                rows.emplace_back(chunk->debug_row(i));
+            }
+        }
+    }
+    ASSERT_TRUE(_recvr->is_finished());
+
+    auto expected_rows = _rows_of(chunks);
+    std::sort(expected_rows.begin(), expected_rows.end());
+    std::sort(rows.begin(), rows.end());
+    ASSERT_EQ(expected_rows, rows);
+}
+
+} // namespace starrocks
@@ -0,0 +1,80 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/mysql_result_writer.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "types/date_value.h"
+
+namespace starrocks {
+
+// The rows built column by column must be the same as the rows built row by row.
+TEST(MysqlTextRowsBuilderTest, test_build) {
+    const size_t num_rows = 100;
+    auto int_column = Int32Column::create();
+    auto bigint_column = NullableColumn::create(Int64Column::create(), NullColumn::create());
+    auto double_column = DoubleColumn::create();
+    auto string_column = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    auto date_column = DateColumn::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        int_column->append(i * 7 - 50);
+        if (i % 3 == 0) {
+            bigint_column->append_nulls(1);
+        } else {
+            bigint_column->append_datum(Datum(static_cast<int64_t>(i) << 40));
+        }
+        double_column->append(i * 0.25);
+        if (i % 5 == 0) {
+            string_column->append_nulls(1);
+        } else {
+            std::string s(i * 3, 'a' + i % 26);
+            string_column->append_datum(Datum(Slice(s)));
+        }
+        date_column->append(DateValue::create(2024, 1, 1 + i % 28));
+    }
+    auto const_column = ColumnHelper::create_const_column<TYPE_INT>(42, num_rows);
+    // a VARCHAR column upgraded to LargeBinaryColumn is serialized row by row
+    auto large_string_column = NullableColumn::create(LargeBinaryColumn::create(), NullColumn::create());
+    for (size_t i = 0; i < num_rows; i++) {
+        std::string s(i % 7, 'z');
+        large_string_column->append_datum(Datum(Slice(s)));
+    }
+
+    Columns columns{int_column,  bigint_column, double_column,      string_column,
+                    date_column, const_column,  large_string_column};
+    std::vector<LogicalType> types{TYPE_INT, TYPE_BIGINT, TYPE_DOUBLE, TYPE_VARCHAR, TYPE_DATE, TYPE_INT, TYPE_VARCHAR};
+
+    MysqlTextRowsBuilder builder;
+    // build twice to check the buffers are reused correctly
+    for (int round = 0; round < 2; round++) {
+        builder.build(columns, types, num_rows);
+        for (size_t i = 0; i < num_rows; i++) {
+            MysqlRowBuffer expected;
+            for (auto& column : columns) {
+                column->put_mysql_row_buffer(&expected, i);
+            }
+            ASSERT_EQ(expected.length(), builder.row_length(i));
+            std::string row = "garbage";
+            builder.copy_row(i, &row);
+            ASSERT_EQ(expected.data(), row);
+        }
+    }
+}
+
+} // namespace starrocks
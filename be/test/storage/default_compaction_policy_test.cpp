@@ -30,9 +30,11 @@
 #include "storage/compaction_manager.h"
 #include "storage/compaction_utils.h"
 #include "storage/cumulative_compaction.h"
+#include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
+#include "storage/rowset/segment.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_meta.h"
 #include "testutil/assert.h"
@@ -48,14 +50,14 @@ public:
             _engine = nullptr;
         }
     }
-    void write_new_version(const TabletMetaSharedPtr& tablet_meta) {
+    void write_new_version(const TabletMetaSharedPtr& tablet_meta, int32_t key_offset = 0) {
         RowsetWriterContext rowset_writer_context;
         create_rowset_writer_context(&rowset_writer_context, _version);
         _version++;
         std::unique_ptr<RowsetWriter> rowset_writer;
         ASSERT_TRUE(RowsetFactory::create_rowset_writer(rowset_writer_context, &rowset_writer).ok());
 
-        rowset_writer_add_rows(rowset_writer);
+        rowset_writer_add_rows(rowset_writer, key_offset);
 
         rowset_writer->flush();
         RowsetSharedPtr src_rowset = *rowset_writer->build();
@@ -189,7 +191,7 @@ public:
         tablet_meta->init_from_pb(&tablet_meta_pb);
     }
 
-    void rowset_writer_add_rows(std::unique_ptr<RowsetWriter>& writer) {
+    void rowset_writer_add_rows(std::unique_ptr<RowsetWriter>& writer, int32_t key_offset = 0) {
         std::vector<std::string> test_data;
         auto schema = ChunkHelper::convert_schema(_tablet_schema);
         for (size_t j = 0; j < 8; ++j) {
@@ -197,7 +199,7 @@ public:
             for (size_t i = 0; i < 128; ++i) {
                 test_data.push_back("well" + std::to_string(i));
                 auto& cols = chunk->columns();
-                cols[0]->append_datum(Datum(static_cast<int32_t>(i)));
+                cols[0]->append_datum(Datum(static_cast<int32_t>(key_offset + i)));
                 Slice field_1(test_data[i]);
                 cols[1]->append_datum(Datum(field_1));
                 cols[2]->append_datum(Datum(static_cast<int32_t>(10000 + i)));
@@ -935,4 +937,87 @@ TEST_F(DefaultCompactionPolicyTest, test_shortcut_compaction) {
     ASSERT_EQ(2, versions[0].second);
 }
 
+TEST_F(DefaultCompactionPolicyTest, test_shortcut_compaction_disjoint_rowsets) {
+    LOG(INFO) << "test_shortcut_compaction_disjoint_rowsets";
+    create_tablet_schema(DUP_KEYS);
+
+    config::enable_shortcut_compaction_for_disjoint_rowsets = true;
+    config::shortcut_compaction_min_segment_bytes = 0;
+    DeferOp defer([&] {
+        config::enable_shortcut_compaction_for_disjoint_rowsets = false;
+        config::shortcut_compaction_min_segment_bytes = 134217728;
+    });
+
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    create_tablet_meta(tablet_meta.get());
+
+    // key ranges do not follow the version order, the segments should be reordered by key
+    write_new_version(tablet_meta, 2000);
+    write_new_version(tablet_meta, 0);
+    write_new_version(tablet_meta, 1000);
+
+    TabletSharedPtr tablet =
+            Tablet::create_tablet_from_meta(tablet_meta, starrocks::StorageEngine::instance()->get_stores()[0]);
+    ASSERT_OK(tablet->init());
+    init_compaction_context(tablet);
+    ASSERT_EQ(3, tablet->version_count());
+
+    bool is_shortcut_compaction = false;
+    auto res = compact(tablet, &is_shortcut_compaction);
+    ASSERT_TRUE(res.ok());
+    ASSERT_TRUE(is_shortcut_compaction);
+
+    ASSERT_EQ(1, tablet->version_count());
+    std::vector<Version> versions;
+    tablet->list_versions(&versions);
+    ASSERT_EQ(1, versions.size());
+    ASSERT_EQ(0, versions[0].first);
+    ASSERT_EQ(2, versions[0].second);
+
+    auto rowset = tablet->get_rowset_by_version(versions[0]);
+    ASSERT_TRUE(rowset != nullptr);
+    ASSERT_EQ(3 * 1024, rowset->num_rows());
+    ASSERT_EQ(3, rowset->num_segments());
+    ASSERT_FALSE(rowset->rowset_meta()->is_segments_overlapping());
+    ASSERT_OK(rowset->load());
+    int32_t last_max = -1;
+    for (const auto& segment : rowset->segments()) {
+        const auto* zone_map = segment->column(0)->segment_zone_map();
+        ASSERT_TRUE(zone_map != nullptr);
+        ASSERT_GT(std::stoi(zone_map->min()), last_max);
+        last_max = std::stoi(zone_map->max());
+    }
+}
+
+TEST_F(DefaultCompactionPolicyTest, test_shortcut_compaction_overlapped_rowsets) {
+    LOG(INFO) << "test_shortcut_compaction_overlapped_rowsets";
+    create_tablet_schema(DUP_KEYS);
+
+    config::enable_shortcut_compaction_for_disjoint_rowsets = true;
+    config::shortcut_compaction_min_segment_bytes = 0;
+    DeferOp defer([&] {
+        config::enable_shortcut_compaction_for_disjoint_rowsets = false;
+        config::shortcut_compaction_min_segment_bytes = 134217728;
+    });
+
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    create_tablet_meta(tablet_meta.get());
+
+    write_new_version(tablet_meta, 0);
+    write_new_version(tablet_meta, 100);
+
+    TabletSharedPtr tablet =
+            Tablet::create_tablet_from_meta(tablet_meta, starrocks::StorageEngine::instance()->get_stores()[0]);
+    ASSERT_OK(tablet->init());
+    init_compaction_context(tablet);
+    ASSERT_EQ(2, tablet->version_count());
+
+    bool is_shortcut_compaction = true;
+    auto res = compact(tablet, &is_shortcut_compaction);
+    ASSERT_TRUE(res.ok());
+    ASSERT_FALSE(is_shortcut_compaction);
+
+    ASSERT_EQ(1, tablet->version_count());
+}
+
 } // namespace starrocks
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <random>
 
 #include "column/datum_tuple.h"
@@ -35,6 +36,7 @@
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks {
@@ -339,6 +341,64 @@ TEST_F(MemTableTest, testUniqKeysInsertFlushRead) {
     ASSERT_EQ(n, pkey_read);
 }
 
+TEST_F(MemTableTest, testUniqKeysMergeSortedRuns) {
+    const string path = "./MemTableTest_testUniqKeysMergeSortedRuns";
+    MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::UNIQUE_KEYS), "pk int,name varchar,pv int",
+            path);
+    int32_t old_max_sorted_runs = config::memtable_max_sorted_runs;
+    config::memtable_max_sorted_runs = 2;
+    DeferOp defer([&] { config::memtable_max_sorted_runs = old_max_sorted_runs; });
+    // merge on every insert, so that there are many sorted runs to be merged
+    _mem_table->set_write_buffer_row(1);
+
+    const size_t n = 1000;
+    const size_t batch = 250;
+    const int rounds = 5;
+    for (int round = 0; round < rounds; round++) {
+        shared_ptr<Chunk> chunk = ChunkHelper::new_chunk(*_slots, n);
+        for (int i = 0; i < n; i++) {
+            chunk->get_column_by_index(0)->append_datum(Datum(static_cast<int32_t>(i)));
+            chunk->get_column_by_index(1)->append_datum(Datum(Slice("name")));
+            chunk->get_column_by_index(2)->append_datum(Datum(static_cast<int32_t>(round)));
+        }
+        vector<uint32_t> indexes(n);
+        std::iota(indexes.begin(), indexes.end(), 0);
+        std::shuffle(indexes.begin(), indexes.end(), std::mt19937(std::random_device()()));
+        for (uint32_t from = 0; from < n; from += batch) {
+            ASSERT_OK(_mem_table->insert(*chunk, indexes.data(), from, batch).status());
+        }
+    }
+    ASSERT_OK(_mem_table->finalize());
+    ASSERT_OK(_mem_table->flush());
+    RowsetSharedPtr rowset = *_writer->build();
+    unique_ptr<Schema> read_schema = create_schema("pk int,name varchar,pv int", 1);
+    OlapReaderStatistics stats;
+    RowsetReadOptions rs_opts;
+    rs_opts.sorted = false;
+    rs_opts.use_page_cache = false;
+    rs_opts.stats = &stats;
+    auto itr = rowset->new_iterator(*read_schema, rs_opts);
+    ASSERT_TRUE(itr.ok()) << itr.status().to_string();
+    std::shared_ptr<Chunk> chunk = ChunkHelper::new_chunk(*read_schema, 4096);
+    int32_t expected_pk = 0;
+    while (true) {
+        Status st = (*itr)->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        auto pk_column = chunk->get_column_by_name("pk");
+        auto pv_column = chunk->get_column_by_name("pv");
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            // keys are sorted and deduplicated, and the value of the last round is kept
+            ASSERT_EQ(expected_pk++, pk_column->get(i).get_int32());
+            ASSERT_EQ(rounds - 1, pv_column->get(i).get_int32());
+        }
+        chunk->reset();
+    }
+    ASSERT_EQ(n, expected_pk);
+}
+
 TEST_F(MemTableTest, testPrimaryKeysWithDeletes) {
     const string path = "./MemTableTest_testPrimaryKeysWithDeletes";
     MySetUp(create_tablet_schema("pk bigint,v1 int", 1, KeysType::PRIMARY_KEYS), "pk bigint,v1 int,__op tinyint", path);
@@ -55,6 +55,8 @@
 #include "storage/tablet_schema.h"
 #include "storage/tablet_schema_helper.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -271,6 +273,55 @@ TEST_F(SegmentReaderWriterTest, TestHorizontalWrite) {
     }
 }
 
+TEST_F(SegmentReaderWriterTest, TestParallelColumnEncode) {
+    const int num_columns = 64;
+    std::vector<ColumnPB> columns;
+    columns.emplace_back(create_int_key_pb(1));
+    columns.emplace_back(create_int_key_pb(2));
+    for (int i = 3; i <= num_columns; ++i) {
+        columns.emplace_back(create_int_value_pb(i));
+    }
+    std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(columns);
+
+    int32_t old_min_columns = config::parallel_column_encode_min_columns;
+    config::parallel_column_encode_min_columns = 32;
+    DeferOp defer([&] { config::parallel_column_encode_min_columns = old_min_columns; });
+    std::unique_ptr<ThreadPool> encode_pool;
+    ASSERT_OK(ThreadPoolBuilder("column_encode").set_min_threads(0).set_max_threads(4).build(&encode_pool));
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+    opts.column_encode_pool = encode_pool.get();
+    shared_ptr<Segment> segment;
+    const size_t num_rows = 4096;
+    build_segment(opts, tablet_schema, tablet_schema, num_rows, DefaultIntGenerator, &segment);
+
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    SegmentReadOptions seg_options;
+    seg_options.fs = _fs;
+    OlapReaderStatistics stats;
+    seg_options.stats = &stats;
+    ASSIGN_OR_ABORT(auto seg_iterator, segment->new_iterator(schema, seg_options));
+    auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+    size_t count = 0;
+    while (true) {
+        chunk->reset();
+        auto st = seg_iterator->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (size_t i = 0; i < chunk->num_rows(); ++i) {
+            for (int cid = 0; cid < num_columns; ++cid) {
+                ASSERT_EQ(DefaultIntGenerator(count, cid, 0).get_int32(),
+                          chunk->get_column_by_index(cid)->get(i).get_int32());
+            }
+            ++count;
+        }
+    }
+    ASSERT_EQ(num_rows, count);
+}
+
 // NOLINTNEXTLINE
 TEST_F(SegmentReaderWriterTest, TestVerticalWrite) {
     std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(
@@ -27,6 +27,7 @@
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_options.h"
+#include "storage/rowset/segment.h"
 #include "storage/rowset_column_update_state.h"
 #include "storage/schema_change_utils.h"
 #include "storage/snapshot_manager.h"
@@ -603,6 +604,108 @@ TEST_P(RowsetColumnPartialUpdateTest, partial_update_compaction_and_check) {
     }
 }
 
+static StatusOr<SegmentFooterPB> read_segment_footer(const std::string& path, uint64_t* file_size) {
+    ASSIGN_OR_RETURN(auto rfile, FileSystem::Default()->new_random_access_file(path));
+    ASSIGN_OR_RETURN(*file_size, rfile->get_size());
+    SegmentFooterPB footer;
+    RETURN_IF_ERROR(Segment::parse_segment_footer(rfile.get(), &footer, nullptr, nullptr));
+    return footer;
+}
+
+static uint64_t ordinal_index_offset(const ColumnMetaPB& column_meta) {
+    for (const auto& index : column_meta.indexes()) {
+        if (index.type() == ORDINAL_INDEX) {
+            return index.ordinal_index().root_page().root_page().offset();
+        }
+    }
+    return 0;
+}
+
+TEST_P(RowsetColumnPartialUpdateTest, partial_update_column_subset_compaction_and_check) {
+    const int N = 100;
+    auto tablet = create_tablet(rand(), rand());
+    ASSERT_EQ(1, tablet->updates()->version_history_count());
+    int64_t version = 1;
+    int64_t version_before_partial_update = 1;
+    prepare_tablet(this, tablet, version, version_before_partial_update, N);
+
+    const bool old_enable = config::enable_pk_column_subset_compaction;
+    const bool old_lazy = config::enable_lazy_delta_column_compaction;
+    const double old_ratio = config::pk_column_subset_compaction_max_column_ratio;
+    config::enable_pk_column_subset_compaction = true;
+    config::enable_lazy_delta_column_compaction = false;
+    config::pk_column_subset_compaction_max_column_ratio = 1.0;
+    DeferOp defer([&]() {
+        config::enable_pk_column_subset_compaction = old_enable;
+        config::enable_lazy_delta_column_compaction = old_lazy;
+        config::pk_column_subset_compaction_max_column_ratio = old_ratio;
+    });
+
+    // pk column meta of the input segments and their file sizes, to check which pages are copied
+    std::vector<std::pair<std::string, uint64_t>> input_pk_metas;
+    {
+        std::vector<RowsetSharedPtr> rowsets;
+        ASSERT_OK(tablet->updates()->get_applied_rowsets(version, &rowsets));
+        for (const auto& rowset : rowsets) {
+            for (int i = 0; i < rowset->num_segments(); i++) {
+                uint64_t file_size = 0;
+                auto footer = read_segment_footer(
+                        Rowset::segment_file_path(rowset->rowset_path(), rowset->rowset_id(), i), &file_size);
+                if (footer.ok()) {
+                    input_pk_metas.emplace_back(footer->columns(0).SerializeAsString(), file_size);
+                }
+            }
+        }
+    }
+    {
+        // compaction, the only live rowset is rewritten with its delta column groups
+        compact(tablet, version, 1, _compaction_mem_tracker.get());
+        // check data
+        ASSERT_TRUE(check_tablet(tablet, version, N, [](int64_t k1, int64_t v1, int32_t v2) {
+            return (int16_t)(k1 % 100 + 3) == v1 && (int32_t)(k1 % 1000 + 4) == v2;
+        }));
+        // the output rowset has no delta column groups
+        std::vector<RowsetSharedPtr> rowsets;
+        ASSERT_OK(tablet->updates()->get_applied_rowsets(version, &rowsets));
+        ASSERT_EQ(1, rowsets.size());
+        for (int i = 0; i < rowsets[0]->num_segments(); i++) {
+            DeltaColumnGroupList dcgs;
+            TabletSegmentId tsid(tablet->tablet_id(), rowsets[0]->rowset_meta()->get_rowset_seg_id() + i);
+            ASSERT_OK(StorageEngine::instance()->update_manager()->get_delta_column_group(
+                    tablet->data_dir()->get_meta(), tsid, version, &dcgs));
+            ASSERT_TRUE(dcgs.empty());
+        }
+
+        // the segments are rewritten by column subset compaction: the pk column is copied as is,
+        // v1 and v2 are appended after the bytes of the input segment
+        const auto& schema = tablet->tablet_schema();
+        const int32_t v1_uid = schema->column(schema->field_index("v1")).unique_id();
+        const int32_t v2_uid = schema->column(schema->field_index("v2")).unique_id();
+        ASSERT_GT(rowsets[0]->num_segments(), 0);
+        for (int i = 0; i < rowsets[0]->num_segments(); i++) {
+            uint64_t file_size = 0;
+            ASSIGN_OR_ABORT(auto footer,
+                            read_segment_footer(Rowset::segment_file_path(rowsets[0]->rowset_path(),
+                                                                          rowsets[0]->rowset_id(), i),
+                                                &file_size));
+            ASSERT_GT(footer.garbage_bytes(), 0);
+            ASSERT_LT(footer.garbage_bytes(), file_size);
+            auto input = std::find_if(input_pk_metas.begin(), input_pk_metas.end(), [&](const auto& pk_meta) {
+                return pk_meta.first == footer.columns(0).SerializeAsString();
+            });
+            ASSERT_TRUE(input != input_pk_metas.end());
+            int num_rewritten = 0;
+            for (const auto& column : footer.columns()) {
+                if (column.unique_id() == v1_uid || column.unique_id() == v2_uid) {
+                    ASSERT_GE(ordinal_index_offset(column), input->second);
+                    num_rewritten++;
+                }
+            }
+            ASSERT_EQ(2, num_rewritten);
+        }
+    }
+}
+
 TEST_P(RowsetColumnPartialUpdateTest, TEST_Pull_clone) {
     const int N = 100;
     auto tablet = create_tablet(rand(), rand());
@@ -14,6 +14,9 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+#include <vector>
+
 #include "util/bit_packing.inline.h"
 
 namespace starrocks {
@@ -94,4 +97,37 @@ TEST(BitPacking, UnpackValues) {
     }
 }
 
+// Unpack random data of every bit width and compare with the values extracted bit by bit.
+template <typename OutType>
+static void test_unpack_all_bit_widths(int max_bit_width) {
+    std::mt19937 rng(0);
+    const int num_values = 1000;
+    for (int bit_width = 1; bit_width <= max_bit_width; bit_width++) {
+        std::vector<uint8_t> data(BitUtil::RoundUpNumBytes(num_values * bit_width));
+        for (auto& byte : data) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        std::vector<OutType> result(num_values);
+        auto [pos, num] = BitPacking::UnpackValues<OutType>(bit_width, data.data(), data.size(), num_values,
+                                                            result.data());
+        ASSERT_EQ(pos, data.data() + data.size());
+        ASSERT_EQ(num, num_values);
+
+        for (int i = 0; i < num_values; i++) {
+            uint64_t expected = 0;
+            for (int bit = 0; bit < bit_width; bit++) {
+                int bit_pos = i * bit_width + bit;
+                expected |= static_cast<uint64_t>((data[bit_pos / 8] >> (bit_pos % 8)) & 1) << bit;
+            }
+            ASSERT_EQ(static_cast<OutType>(expected), result[i]) << "bit_width=" << bit_width << ", i=" << i;
+        }
+    }
+}
+
+TEST(BitPacking, UnpackValuesAllBitWidths) {
+    test_unpack_all_bit_widths<uint32_t>(32);
+    test_unpack_all_bit_widths<int16_t>(16);
+    test_unpack_all_bit_widths<uint64_t>(64);
+}
+
 } // namespace starrocks
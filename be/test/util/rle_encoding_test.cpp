@@ -38,6 +38,7 @@
 #include <cstring>
 #include <limits>
 #include <ostream>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -521,4 +522,35 @@ TEST_F(TestRle, TestGetBatchWithDictOutOfRange) {
     ASSERT_EQ(-1, n);
 }
 
+TEST_F(TestRle, TestBatchSkip) {
+    for (int bit_width : {1, 3, 8, 13}) {
+        faststring buffer;
+        RleEncoder<uint32_t> encoder(&buffer, bit_width);
+        std::vector<uint32_t> values;
+        std::mt19937 rng(bit_width);
+        for (int i = 0; i < 4096; ++i) {
+            // mix repeated runs and literal runs
+            uint32_t value = (i / 100) % 2 == 0 ? 1 : rng() % (1 << bit_width);
+            values.push_back(value);
+            encoder.Put(value);
+        }
+        encoder.Flush();
+
+        RleBatchDecoder<uint32_t> decoder(buffer.data(), buffer.size(), bit_width);
+        size_t pos = 0;
+        std::vector<uint32_t> read(4096);
+        while (pos < values.size()) {
+            int32_t to_skip = std::min<int32_t>(rng() % 70, values.size() - pos);
+            ASSERT_EQ(to_skip, decoder.Skip(to_skip));
+            pos += to_skip;
+            int32_t to_read = std::min<int32_t>(rng() % 40 + 1, values.size() - pos);
+            ASSERT_EQ(to_read, decoder.GetBatch(read.data(), to_read));
+            for (int i = 0; i < to_read; ++i) {
+                ASSERT_EQ(values[pos + i], read[i]) << "bit_width=" << bit_width << ", pos=" << pos + i;
+            }
+            pos += to_read;
+        }
+    }
+}
+
 } // namespace starrocks